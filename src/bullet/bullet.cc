@@ -38,7 +38,7 @@ float Bullet::GetDamage() const
 	return config.damage;
 }
 
-std::string Bullet::GetTag() const
+const std::string& Bullet::GetTag() const
 {
 	return config.tag;
 }
@@ -95,13 +95,14 @@ public:
 
 	virtual void Update(float dt, float worldSpeed) = 0;
 	virtual void Draw(const std::shared_ptr<IRenderer>& renderer, float interp) = 0;
-	virtual std::vector<std::shared_ptr<Collision>> DetectCollisions(const CollisionQuadTree& quadTree) = 0;
+	// Append this tick's collisions to the caller's buffer
+	virtual void DetectCollisions(const CollisionQuadTree& quadTree, std::vector<Collision>& collisions) = 0;
 
 	bool isSpent() const;
 	sf::Vector2f GetPosition() const;
 	sf::Vector2f GetVelocity() const;
 	float GetDamage() const;
-	std::string GetTag() const;
+	const std::string& GetTag() const;
 	std::function<void(bool, float)> GetCollisionResolver() const;
 
 
@@ -28,20 +28,21 @@ void BulletSystem::Update(const CollisionQuadTree& quadTree, float dt, float wor
 	this->EraseBullets();
 
 	// Determine collisions to resolve
-	std::vector<std::shared_ptr<Collision>> unresolved;
+	this->unresolved.clear();
 	for (auto& b : this->bullets)
 	{
 		b->Update(dt, worldSpeed);
 
-		auto collisions = b->DetectCollisions(quadTree);
-		if (!collisions.empty() && b->GetDamage() > 0.0f)
+		const auto first = this->unresolved.size();
+		b->DetectCollisions(quadTree, this->unresolved);
+		if (b->GetDamage() <= 0.0f)
 		{
-			unresolved.reserve(std::max(unresolved.capacity(), unresolved.size() + collisions.size()));
-			unresolved.insert(unresolved.end(), collisions.begin(), collisions.end());
+			// Harmless this tick (e.g. beam between damage ticks), drop its hits
+			this->unresolved.erase(this->unresolved.begin() + first, this->unresolved.end());
 		}
 	}
 
-	BulletSystem::ResolveCollisions(unresolved);
+	BulletSystem::ResolveCollisions(this->unresolved);
 }
 
 void BulletSystem::Draw(const std::shared_ptr<IRenderer>& renderer, float interp)
@@ -64,13 +65,13 @@ void BulletSystem::EraseBullets()
     });
 }
 
-void BulletSystem::ResolveCollisions(const std::vector<std::shared_ptr<Collision>>& collisions)
+void BulletSystem::ResolveCollisions(const std::vector<Collision>& collisions)
 {
     for(const auto& c : collisions)
     {
-        auto damage = c->bullet->GetDamage();
-        c->bullet->GetCollisionResolver()(
-            c->target->payload->resolver(damage, c->collisionPosition),
+        auto damage = c.bullet->GetDamage();
+        c.bullet->GetCollisionResolver()(
+            c.target->payload->resolver(damage, c.collisionPosition),
             damage
         );
     }
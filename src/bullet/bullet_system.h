@@ -4,8 +4,10 @@
 
 #include <SFML/Graphics.hpp>
 #include <memory>
+#include <vector>
 
 #include "i_bullet_system.h"
+#include "bullet/collision.h"
 
 class Bullet;
 struct BulletConfig;
@@ -28,10 +30,11 @@ public:
 private:
 	void AddBullet(const std::shared_ptr<Bullet>& bullet);
 	void EraseBullets();
-	static void ResolveCollisions(const std::vector<std::shared_ptr<Collision>>& collisions) ;
+	static void ResolveCollisions(const std::vector<Collision>& collisions) ;
 
 private:
 	std::vector<std::shared_ptr<Bullet>> bullets;
+	std::vector<Collision> unresolved; // Reused between frames
 	sf::FloatRect bounds;
 };
 
@@ -1,7 +1,10 @@
 #ifndef COLLISION_H
 #define COLLISION_H
 
+#include <SFML/Graphics.hpp>
 #include <memory>
+#include <optional>
+#include <functional>
 
 class Bullet;
 
@@ -11,7 +14,7 @@ struct Point;
 struct CollisionMediators
 {
 	std::function<bool(float, sf::Vector2f)> resolver;
-	std::function<std::shared_ptr<sf::Vector2f>(sf::Vector2f, sf::Vector2f, bool ray)> pointTest;
+	std::function<std::optional<sf::Vector2f>(sf::Vector2f, sf::Vector2f, bool ray)> pointTest;
 	std::function<bool(sf::FloatRect&)> zoneTest;
 
 	CollisionMediators SetCollisionResolver(std::function<bool(float, sf::Vector2f)> r) {
@@ -19,7 +22,7 @@ struct CollisionMediators
 		return *this;
 	}
 
-	CollisionMediators SetPointTest(std::function<std::shared_ptr<sf::Vector2f>(sf::Vector2f, sf::Vector2f, bool ray)> pt) {
+	CollisionMediators SetPointTest(std::function<std::optional<sf::Vector2f>(sf::Vector2f, sf::Vector2f, bool ray)> pt) {
 		this->pointTest = pt;
 		return *this;
 	}
@@ -30,14 +33,16 @@ struct CollisionMediators
 	}
 };
 
+// Plain value so collision buffers can be reused between frames
+// bullet and target are non owning, valid until the bullet system / quad tree is next modified
 struct Collision {
-	std::shared_ptr<Bullet> bullet;
-	std::shared_ptr<Point<CollisionMediators>> target;
+	Bullet* bullet;
+	const Point<CollisionMediators>* target;
 	sf::Vector2f collisionPosition;
 
 	Collision(
-		std::shared_ptr<Bullet> bullet,
-		std::shared_ptr<Point<CollisionMediators>> target,
+		Bullet* bullet,
+		const Point<CollisionMediators>* target,
 		sf::Vector2f collisionPosition = sf::Vector2f()
     )
 		: bullet(bullet), target(target), collisionPosition(collisionPosition)
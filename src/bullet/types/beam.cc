@@ -11,7 +11,7 @@ Beam::Beam(BulletTrajectory& trajectory, BulletConfig& config, std::shared_ptr<I
 	: Bullet(trajectory, config),
 	rayCaster(rayCaster),
 	round(std::make_shared<sf::RectangleShape>(sf::Vector2f(20.0f, 5.0f))),
-	collisionPosition(std::shared_ptr<sf::Vector2f>(nullptr)),
+	collisionPosition(std::nullopt),
 	bounds(bounds),
 	damageRateAccumulator(0.0f),
 	damageRate(damageRate),
@@ -32,7 +32,7 @@ void Beam::Update(float dt, float worldSpeed)
 
 	auto beamEnd = collisionPosition ?
 		*collisionPosition :
-		this->rayCaster->RayBoxIntersects(this->position, this->velocity, bounds)->point;
+		this->rayCaster->RayBoxIntersects(this->position, this->velocity, bounds).point;
 
 	this->round->setSize(
 		sf::Vector2f(
@@ -80,43 +80,43 @@ void Beam::Draw(const std::shared_ptr<IRenderer>& renderer, float interp)
 	}
 }
 
-std::vector<std::shared_ptr<Collision>> Beam::DetectCollisions(const CollisionQuadTree& quadTree)
+void Beam::DetectCollisions(const CollisionQuadTree& quadTree, std::vector<Collision>& collisions)
 {
 	// Clear collision point before detection
-	collisionPosition = nullptr;
+	collisionPosition.reset();
 
-	std::vector<std::shared_ptr<Collision>> collisions;
+	const auto first = collisions.size();
 	auto query = RayQuery(rayCaster, this->position, this->velocity);
-	quadTree->Query(&query, collisions,
-		[this](std::shared_ptr<Point<CollisionMediators>> point) -> std::shared_ptr<Collision> {
-			if (point->tag != this->GetTag())
+	quadTree->Query(query, collisions,
+		[this](const Point<CollisionMediators>& point) -> std::optional<Collision> {
+			if (point.tag != this->GetTag())
 			{
-				auto collision = point->payload->pointTest(this->position, this->velocity, true);
+				auto collision = point.payload->pointTest(this->position, this->velocity, true);
 				if (collision) {
-					return std::make_shared<Collision>(this->shared_from_this(), point, *collision);
+					return Collision(this, &point, *collision);
 				}
 			}		
-			return nullptr;
+			return std::nullopt;
 		});
 
-	if (collisions.size() > 1)
+	// Only sort the hits this beam appended
+	auto hits = collisions.begin() + first;
+	if (collisions.end() - hits > 1)
 	{
-		std::sort(collisions.begin(), collisions.end(),
-			[this](std::shared_ptr<Collision> a, std::shared_ptr<Collision> b) -> bool {
-				auto aDist = Dimensions::ManhattanDistance(this->position, a->collisionPosition);
-				auto bDist = Dimensions::ManhattanDistance(this->position, b->collisionPosition);
+		std::sort(hits, collisions.end(),
+			[this](const Collision& a, const Collision& b) -> bool {
+				auto aDist = Dimensions::ManhattanDistance(this->position, a.collisionPosition);
+				auto bDist = Dimensions::ManhattanDistance(this->position, b.collisionPosition);
 				return aDist < bDist;
 			});
 	}
 
 	// Set collision point to hit the first entity if the beam cant penetrate
-	if (!config.penetrating && collisions.size())
+	if (!config.penetrating && hits != collisions.end())
 	{
-		collisionPosition = std::make_shared<sf::Vector2f>(collisions.front()->collisionPosition);
-		collisions = { collisions.front() };
+		collisionPosition = hits->collisionPosition;
+		collisions.erase(hits + 1, collisions.end());
 	}
-
-	return collisions;
 }
 
 void Beam::Reignite()
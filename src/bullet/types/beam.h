@@ -3,6 +3,7 @@
 
 
 #include <SFML/Graphics.hpp>
+#include <optional>
 
 #include "bullet/bullet.h"
 
@@ -18,7 +19,7 @@ public:
 
 	void Update(float dt, float worldSpeed) override;
 	void Draw(const std::shared_ptr<IRenderer>& renderer, float interp) override;
-	std::vector<std::shared_ptr<Collision>> DetectCollisions(const CollisionQuadTree& quadTree) override;
+	void DetectCollisions(const CollisionQuadTree& quadTree, std::vector<Collision>& collisions) override;
 
 	void Reignite();
 	void Cease();
@@ -26,7 +27,7 @@ public:
 protected:
 	std::shared_ptr<IRayCaster> rayCaster;
 	std::shared_ptr<sf::RectangleShape> round;
-	std::shared_ptr<sf::Vector2f> collisionPosition;
+	std::optional<sf::Vector2f> collisionPosition;
 	sf::FloatRect bounds;
 
 	float damageRateAccumulator;
@@ -16,7 +16,7 @@ public:
 
 	~Debris() override = default;
 
-	std::vector<std::shared_ptr<Collision>> DetectCollisions(const CollisionQuadTree& quadTree) override { return {}; }
+	void DetectCollisions(const CollisionQuadTree& quadTree, std::vector<Collision>& collisions) override {}
 };
 
 #endif // DEBRIS_H
\ No newline at end of file
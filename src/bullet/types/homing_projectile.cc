@@ -27,7 +27,7 @@ void HomingProjectile::Draw(const std::shared_ptr<IRenderer>& renderer, float in
 	Projectile::Draw(renderer, interp);
 }
 
-std::vector<std::shared_ptr<Collision>> HomingProjectile::DetectCollisions(const CollisionQuadTree& quadTree)
+void HomingProjectile::DetectCollisions(const CollisionQuadTree& quadTree, std::vector<Collision>& collisions)
 {
 	auto distance = 200.0f;
 	this->zone = sf::FloatRect(
@@ -38,31 +38,30 @@ std::vector<std::shared_ptr<Collision>> HomingProjectile::DetectCollisions(const
     );
 	auto query = RectangleQuery(this->zone);
 
-	std::vector<std::shared_ptr<Collision>> collisions;
+	this->candidates.clear();
 	quadTree->Query(
-        &query,
-        collisions,
-		[this](const auto& point) -> std::shared_ptr<Collision> {
-			if (point->tag != this->GetTag() && point->payload->zoneTest(this->zone))
+        query,
+        this->candidates,
+		[this](const Point<CollisionMediators>& point) -> std::optional<Collision> {
+			if (point.tag != this->GetTag() && point.payload->zoneTest(this->zone))
 			{
-				return std::make_shared<Collision>(this->shared_from_this(), point);
+				return Collision(this, &point);
 			}
-			return nullptr;
+			return std::nullopt;
 		}
     );
 
 	this->line = {};
-	std::vector<std::shared_ptr<Collision>> fineTuned;
-	if (!collisions.empty())
+	if (!this->candidates.empty())
 	{
 		// We want to check all for collisions just in case
-		for (auto& c : collisions)
+		for (auto& c : this->candidates)
 		{
-			auto collision = c->target->payload->pointTest(this->position, this->velocity, false);
+			auto collision = c.target->payload->pointTest(this->position, this->velocity, false);
 			if (collision)
 			{
-				c->collisionPosition = *collision;
-				fineTuned.push_back(c);
+				c.collisionPosition = *collision;
+				collisions.push_back(c);
 				if (!config.penetrating)
 				{
 					this->spent = true;
@@ -73,12 +72,12 @@ std::vector<std::shared_ptr<Collision>> HomingProjectile::DetectCollisions(const
 
 		if (!this->spent)
 		{
-			// find closest
-			ranges::sort(
-                collisions,
+			// find closest, only the nearest candidate steers so no full sort is needed
+			auto closest = ranges::min_element(
+                this->candidates,
 				[this](const auto& a, const auto& b) -> bool {
-					auto aDist = Dimensions::ManhattanDistance(this->position, a->target->position);
-					auto bDist = Dimensions::ManhattanDistance(this->position, b->target->position);
+					auto aDist = Dimensions::ManhattanDistance(this->position, a.target->position);
+					auto bDist = Dimensions::ManhattanDistance(this->position, b.target->position);
 					return aDist < bDist;
 				}
             );
@@ -93,17 +92,15 @@ std::vector<std::shared_ptr<Collision>> HomingProjectile::DetectCollisions(const
 
 			// Debug line for testing
 			this->line = {
-				sf::Vertex(collisions.front()->target->position),
+				sf::Vertex(closest->target->position),
 				sf::Vertex(this->position)
 			};
 
 			// tend towards closest target
-			auto direction = collisions.front()->target->position - this->position;
+			auto direction = closest->target->position - this->position;
 			auto magnitude = Dimensions::Magnitude(direction);
 			auto normalisedDirection = Dimensions::Normalise(direction);
 			this->velocity = Dimensions::Normalise(this->velocity + (normalisedDirection / (0.2f * magnitude)));
 		}
 	}
-
-	return fineTuned;
-}
\ No newline at end of file
+}
@@ -3,6 +3,7 @@
 
 #include <SFML/Graphics.hpp>
 #include <array>
+#include <vector>
 
 #include "projectile.h"
 #include "quad_tree/quad_tree.h"
@@ -13,9 +14,10 @@ public:
 	HomingProjectile(BulletTrajectory& trajectory, BulletConfig& config);
 	~HomingProjectile() override = default;
 	void Draw(const std::shared_ptr<IRenderer>& renderer, float interp) override;
-	virtual std::vector<std::shared_ptr<Collision>> DetectCollisions(const CollisionQuadTree& quadTree) override;
+	virtual void DetectCollisions(const CollisionQuadTree& quadTree, std::vector<Collision>& collisions) override;
 
 private:
+	std::vector<Collision> candidates; // Zone query results, reused between frames
 	std::array<sf::Vertex, 2> line;
 	sf::FloatRect zone;
 };
@@ -61,31 +61,29 @@ void Projectile::Draw(const std::shared_ptr<IRenderer>& renderer, float interp)
 	renderer->GetDebugTarget().draw(line.data(), 2, sf::Lines);
 }
 
-std::vector<std::shared_ptr<Collision>> Projectile::DetectCollisions(const CollisionQuadTree& quadTree)
+void Projectile::DetectCollisions(const CollisionQuadTree& quadTree, std::vector<Collision>& collisions)
 {
-	std::vector<std::shared_ptr<Collision>> collisions;
+	const auto first = collisions.size();
 	auto query = RectangleQuery(this->round->getGlobalBounds());
 
 	quadTree->Query(
-        &query,
+        query,
         collisions,
-		[this](std::shared_ptr<Point<CollisionMediators>> point) -> std::shared_ptr<Collision> {
-			if (point->tag != this->GetTag())
+		[this](const Point<CollisionMediators>& point) -> std::optional<Collision> {
+			if (point.tag != this->GetTag())
 			{
-				auto collision = point->payload->pointTest(this->position, this->velocity, false);
+				auto collision = point.payload->pointTest(this->position, this->velocity, false);
 				if (collision)
                 {
-					return std::make_shared<Collision>(this->shared_from_this(), point, *collision);
+					return Collision(this, &point, *collision);
 				}
 			}
-			return nullptr;
+			return std::nullopt;
 		}
     );
 
-	if (collisions.size() && !config.penetrating)
+	if (collisions.size() > first && !config.penetrating)
 	{
 		this->spent = true;
 	}
-
-	return collisions;
 }
\ No newline at end of file
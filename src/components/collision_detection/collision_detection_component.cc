@@ -6,20 +6,42 @@ CollisionDetectionComponent::CollisionDetectionComponent(std::shared_ptr<IRayCas
 	: rayCaster(rayCaster)
 {}
 
-std::shared_ptr<sf::Vector2f> CollisionDetectionComponent::DetectCollision(const sf::FloatRect& box, const sf::Vector2f& position, bool ray, const sf::Vector2f& dir) const
+std::optional<sf::Vector2f> CollisionDetectionComponent::DetectCollision(const sf::FloatRect& box, const sf::Vector2f& position, bool ray, const sf::Vector2f& dir) const
 {
 	if (!ray && box.contains(position))
 	{
-		return std::make_shared<sf::Vector2f>(position);
+		return position;
 	}
 
 	auto intersection = this->rayCaster->RayBoxIntersects(position, dir, box);
-	if (intersection->intersects)
+	if (intersection.intersects)
 	{
-		return std::make_shared<sf::Vector2f>(intersection->point);
+		return intersection.point;
 	}
 
-	return nullptr;
+	return std::nullopt;
+}
+
+std::optional<sf::Vector2f> CollisionDetectionComponent::DetectRayCollision(const RayBoxBatch& boxes, const sf::Vector2f& position, const sf::Vector2f& dir) const
+{
+	this->rayCaster->RayBoxIntersects(position, dir, boxes, this->intersections);
+
+	// Nearest box the ray hits
+	const RayIntersection* nearest = nullptr;
+	for (const auto& intersection : this->intersections)
+	{
+		if (intersection.intersects && (!nearest || intersection.distance < nearest->distance))
+		{
+			nearest = &intersection;
+		}
+	}
+
+	if (nearest)
+	{
+		return nearest->point;
+	}
+
+	return std::nullopt;
 }
 
 bool CollisionDetectionComponent::DetectIntersection(const sf::FloatRect& boxA, const sf::FloatRect& boxB) const
@@ -4,10 +4,10 @@
 
 #include <SFML/Graphics.hpp>
 #include <memory>
+#include <vector>
 
 #include "i_collision_detection_component.h"
-
-class IRayCaster;
+#include "util/i_ray_caster.h"
 
 class CollisionDetectionComponent : public ICollisionDetectionComponent
 {
@@ -15,10 +15,12 @@ public:
 	explicit CollisionDetectionComponent(std::shared_ptr<IRayCaster> rayCaster);
 	~CollisionDetectionComponent() override = default;
 
-    std::shared_ptr<sf::Vector2f> DetectCollision(const sf::FloatRect& box, const sf::Vector2f& position, bool ray = false, const sf::Vector2f& dir = sf::Vector2f()) const override;
+    std::optional<sf::Vector2f> DetectCollision(const sf::FloatRect& box, const sf::Vector2f& position, bool ray = false, const sf::Vector2f& dir = sf::Vector2f()) const override;
+    std::optional<sf::Vector2f> DetectRayCollision(const RayBoxBatch& boxes, const sf::Vector2f& position, const sf::Vector2f& dir) const override;
     bool DetectIntersection(const sf::FloatRect& boxA, const sf::FloatRect& boxB) const override;
 private:
 	std::shared_ptr<IRayCaster> rayCaster;
+	mutable std::vector<RayIntersection> intersections; // Reused by DetectRayCollision
 };
 
 #endif //COLLISION_DETECTION_COMPONENT_H
\ No newline at end of file
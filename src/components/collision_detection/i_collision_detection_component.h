@@ -4,15 +4,20 @@
 
 #include <SFML/Graphics.hpp>
 #include <memory>
+#include <optional>
 #include <functional>
 
+struct RayBoxBatch;
+
 class ICollisionDetectionComponent
 {
 public:
 	ICollisionDetectionComponent() = default;
 	virtual ~ICollisionDetectionComponent() = default;
 
-    [[nodiscard]] virtual std::shared_ptr<sf::Vector2f> DetectCollision(const sf::FloatRect& box, const sf::Vector2f& position, bool ray = false, const sf::Vector2f& dir = sf::Vector2f()) const = 0;
+    [[nodiscard]] virtual std::optional<sf::Vector2f> DetectCollision(const sf::FloatRect& box, const sf::Vector2f& position, bool ray = false, const sf::Vector2f& dir = sf::Vector2f()) const = 0;
+	// Nearest point where a ray enters (or leaves, when starting inside) any of the boxes
+    [[nodiscard]] virtual std::optional<sf::Vector2f> DetectRayCollision(const RayBoxBatch& boxes, const sf::Vector2f& position, const sf::Vector2f& dir) const = 0;
 	[[nodiscard]] virtual bool DetectIntersection(const sf::FloatRect& boxA, const sf::FloatRect& boxB) const = 0;
 };
 
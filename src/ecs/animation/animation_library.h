@@ -0,0 +1,109 @@
+#ifndef ECS_ANIMATION_LIBRARY_H
+#define ECS_ANIMATION_LIBRARY_H
+
+#include <SFML/Graphics.hpp>
+#include "../components/components.h"
+#include <vector>
+#include <utility>
+#include <cstdint>
+#include <algorithm>
+
+namespace ecs {
+
+/**
+ * AnimationLibrary - Shared clip definitions for every Animation component
+ * Each sprite sheet layout is registered once as a set. A set maps clip
+ * ids (IDLE=0, MOVING_UP=1, ...) to clips, and every clip's frame rects
+ * are precomputed into one flat table. Animation components only carry a
+ * set handle and the index of the clip they are playing.
+ *
+ * Filled while building prefabs and the player, read-only while systems run.
+ */
+class AnimationLibrary {
+public:
+    static constexpr uint16_t kNoClip = 0xFFFF;
+
+    struct Clip {
+        uint16_t first_frame{0};  // Index of the clip's first rect in the frame table
+        uint16_t frame_count{1};
+        float frame_duration{0.1f};  // Seconds per frame
+        bool loop{true};  // Default, PlayAnimation overrides it per entity
+    };
+
+    void Clear() {
+        frames.clear();
+        clips.clear();
+        clip_slots.clear();
+        sets.clear();
+    }
+
+    // Register a sheet laid out in frame_size cells, clips given as (clip id, definition)
+    uint16_t AddSet(sf::Vector2i frame_size, const std::vector<std::pair<int, AnimationClip>>& definitions) {
+        int max_id = -1;
+        for (const auto& [id, definition] : definitions) {
+            max_id = std::max(max_id, id);
+        }
+
+        Set set{static_cast<uint32_t>(clip_slots.size()), static_cast<uint16_t>(max_id + 1)};
+        clip_slots.resize(clip_slots.size() + set.slot_count, kNoClip);
+
+        for (const auto& [id, definition] : definitions) {
+            if (id < 0) {
+                continue;
+            }
+
+            Clip clip{
+                .first_frame = static_cast<uint16_t>(frames.size()),
+                .frame_count = static_cast<uint16_t>(std::max(definition.frame_count, 1)),
+                .frame_duration = definition.frame_duration,
+                .loop = definition.loop
+            };
+
+            // Frame i sits at (start_col + i, row) in the sheet
+            for (int i = 0; i < clip.frame_count; ++i) {
+                frames.emplace_back(
+                    (definition.start_col + i) * frame_size.x,
+                    definition.row * frame_size.y,
+                    frame_size.x,
+                    frame_size.y
+                );
+            }
+
+            clip_slots[set.first_slot + id] = static_cast<uint16_t>(clips.size());
+            clips.push_back(clip);
+        }
+
+        sets.push_back(set);
+        return static_cast<uint16_t>(sets.size() - 1);
+    }
+
+    // Clip index for a clip id in a set, kNoClip if the set doesn't have it
+    uint16_t FindClip(uint16_t set_id, int clip_id) const {
+        if (set_id >= sets.size()) {
+            return kNoClip;
+        }
+        const auto& set = sets[set_id];
+        if (clip_id < 0 || clip_id >= set.slot_count) {
+            return kNoClip;
+        }
+        return clip_slots[set.first_slot + clip_id];
+    }
+
+    const Clip& GetClip(uint16_t clip) const { return clips[clip]; }
+    const sf::IntRect& GetFrame(uint16_t frame) const { return frames[frame]; }
+
+private:
+    struct Set {
+        uint32_t first_slot;  // Into clip_slots, indexed by clip id
+        uint16_t slot_count;
+    };
+
+    std::vector<sf::IntRect> frames;
+    std::vector<Clip> clips;
+    std::vector<uint16_t> clip_slots;
+    std::vector<Set> sets;
+};
+
+} // namespace ecs
+
+#endif // ECS_ANIMATION_LIBRARY_H
@@ -0,0 +1,232 @@
+#ifndef ECS_COMMAND_BUFFER_H
+#define ECS_COMMAND_BUFFER_H
+
+#include <entt/entt.hpp>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include <utility>
+
+namespace ecs {
+
+/**
+ * CommandBuffer - Structural changes deferred to a sync point
+ * Creates, destroys, emplaces and removes are recorded while systems run
+ * and applied together by Playback, so entities and storages never change
+ * under an iteration. Recording is thread safe, Playback is not.
+ *
+ * Emplaces and removes are kept in one typed queue per component, Playback
+ * applies each queue as a bulk insert and a range remove on its storage.
+ * Playback order: queued creates in one batch, then each component's
+ * emplaces (the last one recorded for an entity wins) and removes (a
+ * remove wins over an emplace of the same component), then destroys.
+ * Destroys are de-duplicated and applied as one range, an entity queued
+ * twice (a bullet in several collision pairs) is only destroyed once.
+ * Commands on an entity that is no longer valid are dropped. Playback can
+ * be given a recycle hook that takes over some destroys (pooled entities
+ * go back to their pool).
+ */
+class CommandBuffer {
+public:
+    // Entity created at playback, components can be queued on it before then
+    struct PendingEntity {
+        uint32_t index;
+    };
+
+    PendingEntity Create() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return PendingEntity{pending_creates++};
+    }
+
+    void Destroy(entt::entity entity) {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto index = entt::to_entity(entity);
+        if (index >= destroy_queued.size()) {
+            destroy_queued.resize(index + 1, entt::null);
+        }
+        if (destroy_queued[index] != entity) {
+            destroy_queued[index] = entity;
+            destroys.push_back(entity);
+        }
+    }
+
+    /**
+     * True once entity is queued for destruction, so later events can skip it
+     * Takes no lock, don't call it while another thread may record a destroy
+     */
+    bool IsDestroyQueued(entt::entity entity) const {
+        auto index = entt::to_entity(entity);
+        return index < destroy_queued.size() && destroy_queued[index] == entity;
+    }
+
+    // Adds or replaces the component
+    template<typename Component>
+    void Emplace(entt::entity entity, Component component) {
+        std::lock_guard<std::mutex> lock(mutex);
+        GetQueue<Component>().emplaces.emplace_back(entity, std::move(component));
+    }
+
+    template<typename Component>
+    void Emplace(PendingEntity entity, Component component) {
+        std::lock_guard<std::mutex> lock(mutex);
+        GetQueue<Component>().pending_emplaces.emplace_back(entity.index, std::move(component));
+    }
+
+    template<typename Component>
+    void Remove(entt::entity entity) {
+        std::lock_guard<std::mutex> lock(mutex);
+        GetQueue<Component>().removes.push_back(entity);
+    }
+
+    bool Empty() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return pending_creates == 0 && destroys.empty() &&
+               std::all_of(queues.begin(), queues.end(), [](const auto& queue) { return !queue || queue->Empty(); });
+    }
+
+    void Clear() {
+        std::lock_guard<std::mutex> lock(mutex);
+        pending_creates = 0;
+        for (auto& queue : queues) {
+            if (queue) {
+                queue->Clear();
+            }
+        }
+        ResetDestroys();
+    }
+
+    // Apply everything recorded, the buffer is empty afterwards
+    void Playback(entt::registry& registry) {
+        Playback(registry, [](entt::entity) { return false; });
+    }
+
+    // As above, recycle(entity) returning true means it handled the destroy
+    template<typename Recycle>
+    void Playback(entt::registry& registry, Recycle&& recycle) {
+        created.resize(pending_creates);
+        if (!created.empty()) {
+            registry.create(created.begin(), created.end());
+        }
+
+        for (auto& queue : queues) {
+            if (queue && !queue->Empty()) {
+                queue->Apply(registry, created);
+            }
+        }
+
+        // Sorted so recycling is deterministic and the range destroy walks the sparse sets in order
+        destroy_range.assign(destroys.begin(), destroys.end());
+        ResetDestroys();
+        std::sort(destroy_range.begin(), destroy_range.end());
+        destroy_range.erase(std::unique(destroy_range.begin(), destroy_range.end()), destroy_range.end());
+        destroy_range.erase(
+            std::remove_if(destroy_range.begin(), destroy_range.end(),
+                [&](entt::entity entity) { return !registry.valid(entity) || recycle(entity); }),
+            destroy_range.end());
+        registry.destroy(destroy_range.begin(), destroy_range.end());
+
+        pending_creates = 0;
+        created.clear();
+        destroy_range.clear();
+    }
+
+private:
+    // Type erased view of one component's queue, only Playback and Clear go through it
+    struct QueueBase {
+        virtual ~QueueBase() = default;
+        virtual bool Empty() const = 0;
+        virtual void Clear() = 0;
+        virtual void Apply(entt::registry& registry, const std::vector<entt::entity>& created) = 0;
+    };
+
+    template<typename Component>
+    struct Queue final : QueueBase {
+        std::vector<std::pair<entt::entity, Component>> emplaces;
+        std::vector<std::pair<uint32_t, Component>> pending_emplaces;  // Index of a queued create
+        std::vector<entt::entity> removes;
+
+        // Playback scratch, kept to reuse capacity
+        std::vector<entt::entity> insert_entities;
+        std::vector<Component> insert_components;
+
+        bool Empty() const override {
+            return emplaces.empty() && pending_emplaces.empty() && removes.empty();
+        }
+
+        void Clear() override {
+            emplaces.clear();
+            pending_emplaces.clear();
+            removes.clear();
+        }
+
+        void Apply(entt::registry& registry, const std::vector<entt::entity>& created) override {
+            for (auto& [index, component] : pending_emplaces) {
+                emplaces.emplace_back(created[index], std::move(component));
+            }
+
+            // Group by entity keeping record order, the last emplace of each run wins
+            std::stable_sort(emplaces.begin(), emplaces.end(), [](const auto& a, const auto& b) {
+                return a.first < b.first;
+            });
+            for (size_t i = 0; i < emplaces.size(); ++i) {
+                auto entity = emplaces[i].first;
+                if ((i + 1 < emplaces.size() && emplaces[i + 1].first == entity) || !registry.valid(entity)) {
+                    continue;
+                }
+                if (registry.all_of<Component>(entity)) {
+                    registry.replace<Component>(entity, std::move(emplaces[i].second));
+                } else {
+                    insert_entities.push_back(entity);
+                    insert_components.push_back(std::move(emplaces[i].second));
+                }
+            }
+            registry.insert<Component>(insert_entities.begin(), insert_entities.end(), insert_components.begin());
+
+            removes.erase(std::remove_if(removes.begin(), removes.end(), [&](entt::entity entity) {
+                return !registry.valid(entity);
+            }), removes.end());
+            registry.remove<Component>(removes.begin(), removes.end());
+
+            Clear();
+            insert_entities.clear();
+            insert_components.clear();
+        }
+    };
+
+    // Caller holds the mutex
+    template<typename Component>
+    Queue<Component>& GetQueue() {
+        auto slot = static_cast<size_t>(entt::type_index<Component>::value());
+        if (slot >= queues.size()) {
+            queues.resize(slot + 1);
+        }
+        if (!queues[slot]) {
+            queues[slot] = std::make_unique<Queue<Component>>();
+        }
+        return static_cast<Queue<Component>&>(*queues[slot]);
+    }
+
+    // Caller holds the mutex or is Playback
+    void ResetDestroys() {
+        for (auto entity : destroys) {
+            destroy_queued[entt::to_entity(entity)] = entt::null;
+        }
+        destroys.clear();
+    }
+
+    mutable std::mutex mutex;
+    uint32_t pending_creates{0};
+    std::vector<std::unique_ptr<QueueBase>> queues;  // Indexed by entt::type_index, null until first use
+    std::vector<entt::entity> destroys;  // Record order, each entity once
+    std::vector<entt::entity> destroy_queued;  // Indexed by entity index, the queued entity or null
+
+    // Playback scratch, kept to reuse capacity
+    std::vector<entt::entity> created;
+    std::vector<entt::entity> destroy_range;
+};
+
+} // namespace ecs
+
+#endif // ECS_COMMAND_BUFFER_H
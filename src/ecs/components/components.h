@@ -10,13 +10,11 @@
 
 namespace ecs {
 
-// Transform component - position, rotation, scale, velocity
+// Transform component - simulation state only (render-only rotation / scale live on Sprite)
 struct Transform {
     sf::Vector2f position{0.0f, 0.0f};
-    sf::Vector2f last_position{0.0f, 0.0f};  // For interpolation
+    sf::Vector2f last_position{0.0f, 0.0f};  // For interpolation and swept collision
     sf::Vector2f velocity{0.0f, 0.0f};
-    float rotation{0.0f};  // In degrees
-    float scale{1.0f};
 };
 
 // Sprite component - visual representation
@@ -26,6 +24,8 @@ struct Sprite {
     sf::Color color{sf::Color::White};
     sf::Vector2f size{32.0f, 32.0f};
     sf::Vector2f origin{16.0f, 16.0f};  // Relative to size
+    float rotation{0.0f};  // In degrees, follows velocity (MovementSystem::UpdateFacing)
+    float scale{1.0f};
     int layer{0};  // Render layer (higher = drawn later)
     bool visible{true};
 };
@@ -45,7 +45,7 @@ struct Health {
 
 // Weapon component - weapon state and config
 struct Weapon {
-    enum class Type {
+    enum class Type : uint8_t {
         SINGLE_SHOT,
         BURST,
         BEAM,
@@ -54,8 +54,8 @@ struct Weapon {
     };
 
     Type type{Type::SINGLE_SHOT};
-    int slot{0};  // Weapon slot number (1-4)
     bool active{true};  // Is this weapon slot enabled?
+    int slot{0};  // Weapon slot number (1-4)
     float cooldown{0.5f};  // Seconds between shots
     float current_cooldown{0.0f};  // Time remaining until can fire
     float damage{10.0f};
@@ -64,18 +64,30 @@ struct Weapon {
     float spread_angle{0.0f};  // For burst weapons
     sf::Color bullet_color{255, 255, 255};
     sf::Vector2f bullet_size{8.0f, 16.0f};
-    std::string script_id;  // Lua script for custom behavior
+    float range{800.0f};  // Beam reach / homing lock-on radius (px)
 };
 
 // Weapons component - multi-weapon system (4 slots for player)
 struct Weapons {
-    std::array<std::optional<Weapon>, 4> slots;
+    std::array<Weapon, 4> slots;  // Only slots with their equipped bit set hold a weapon
+    uint8_t equipped{0};  // Bit per slot
 
     // Helper methods
+    void Equip(int slot_index, const Weapon& weapon) {
+        if (slot_index >= 0 && slot_index < 4) {
+            slots[slot_index] = weapon;
+            equipped |= static_cast<uint8_t>(1u << slot_index);
+        }
+    }
+
+    bool IsEquipped(int slot_index) const {
+        return slot_index >= 0 && slot_index < 4 && (equipped & (1u << slot_index)) != 0;
+    }
+
     std::vector<int> GetActiveSlots() const {
         std::vector<int> active;
         for (int i = 0; i < 4; ++i) {
-            if (slots[i].has_value() && slots[i]->active) {
+            if (IsEquipped(i) && slots[i].active) {
                 active.push_back(i);
             }
         }
@@ -83,36 +95,27 @@ struct Weapons {
     }
 
     void ToggleSlot(int slot_index) {
-        if (slot_index >= 0 && slot_index < 4 && slots[slot_index].has_value()) {
-            slots[slot_index]->active = !slots[slot_index]->active;
+        if (IsEquipped(slot_index)) {
+            slots[slot_index].active = !slots[slot_index].active;
         }
     }
 
     void SetSlotActive(int slot_index, bool active) {
-        if (slot_index >= 0 && slot_index < 4 && slots[slot_index].has_value()) {
-            slots[slot_index]->active = active;
+        if (IsEquipped(slot_index)) {
+            slots[slot_index].active = active;
         }
     }
 
     bool IsSlotActive(int slot_index) const {
-        if (slot_index >= 0 && slot_index < 4 && slots[slot_index].has_value()) {
-            return slots[slot_index]->active;
-        }
-        return false;
+        return IsEquipped(slot_index) && slots[slot_index].active;
     }
 
     Weapon* GetSlot(int slot_index) {
-        if (slot_index >= 0 && slot_index < 4 && slots[slot_index].has_value()) {
-            return &(*slots[slot_index]);
-        }
-        return nullptr;
+        return IsEquipped(slot_index) ? &slots[slot_index] : nullptr;
     }
 
     const Weapon* GetSlot(int slot_index) const {
-        if (slot_index >= 0 && slot_index < 4 && slots[slot_index].has_value()) {
-            return &(*slots[slot_index]);
-        }
-        return nullptr;
+        return IsEquipped(slot_index) ? &slots[slot_index] : nullptr;
     }
 };
 
@@ -130,7 +133,7 @@ struct Physics {
 
 // Movement component - movement behavior
 struct Movement {
-    enum class Pattern {
+    enum class Pattern : uint8_t {
         LINEAR,
         ORBITAL,
         SINE_WAVE,
@@ -151,11 +154,13 @@ struct Movement {
     float pattern_time{0.0f};  // Time in current pattern
 
     sf::Vector2f direction{0.0f, -1.0f};  // Normalized direction
-    std::string script_id;  // Lua script for custom movement
 
     // World scrolling (Gradius-style background drift)
     float world_speed{0.0f};  // Background scroll speed (added to enemy movement)
 
+    // FOLLOW_TARGET chases the nearest collider on these layers (unless AI has a target)
+    uint32_t target_mask{0};
+
     // Orbital movement tracking
     sf::Vector2f orbit_center{0.0f, 0.0f};  // Center point for orbital movement
     bool orbit_initialized{false};  // Has orbit center been set?
@@ -166,12 +171,11 @@ struct Movement {
 
 // Collision component - collision detection data
 struct Collision {
-    enum class Shape {
+    enum class Shape : uint8_t {
         CIRCLE,
         RECTANGLE
     };
 
-    Shape shape{Shape::CIRCLE};
     float radius{16.0f};  // For circle
     sf::Vector2f rect_size{32.0f, 32.0f};  // For rectangle
     sf::Vector2f offset{0.0f, 0.0f};  // Offset from transform position
@@ -180,6 +184,7 @@ struct Collision {
     uint32_t layer{0};  // What layer am I on?
     uint32_t mask{0xFFFFFFFF};  // What layers do I collide with?
 
+    Shape shape{Shape::CIRCLE};  // After the floats so the flags pack into the tail
     bool enabled{true};
 };
 
@@ -189,9 +194,17 @@ struct Lifetime {
     float elapsed{0.0f};  // Time elapsed
 };
 
+// Homing component - steers a projectile toward the nearest target
+struct Homing {
+    float turn_rate{3.0f};  // Max turn speed (radians per second)
+    float range{300.0f};  // Lock-on radius (px)
+    uint32_t target_mask{0};  // Collision layers to home in on
+    entt::entity target{entt::null};  // Current lock, reacquired when lost
+};
+
 // AI component - AI state and behavior
 struct AI {
-    enum class State {
+    enum class State : uint8_t {
         IDLE,
         PATROL,
         CHASE,
@@ -203,8 +216,9 @@ struct AI {
     float state_time{0.0f};  // Time in current state
     float detection_range{200.0f};
     float attack_range{100.0f};
-    std::optional<entt::entity> target;  // Current target entity
-    std::string script_id;  // Lua script for custom AI
+    uint32_t target_mask{0};  // Collision layers worth targeting
+    entt::entity target{entt::null};  // Current target entity
+    sf::Vector2f target_position{0.0f, 0.0f};  // Target position at the last AI update
 };
 
 // Score component - value when destroyed
@@ -236,7 +250,7 @@ struct Children {
     std::vector<entt::entity> entities;
 };
 
-// Animation clip - defines one animation sequence (one row in sprite sheet)
+// Animation clip - defines one animation sequence (one row in sprite sheet), compiled into the AnimationLibrary
 struct AnimationClip {
     int row{0};                  // Which row in sprite sheet
     int start_col{0};            // Starting column
@@ -245,25 +259,18 @@ struct AnimationClip {
     bool loop{true};             // Loop or play once
 };
 
-// Animation component - handles sprite sheet frame animation
+// Animation component - playback state for a clip set in the World's AnimationLibrary
 struct Animation {
-    // Sprite sheet layout
-    sf::Vector2i frame_size{32, 32};         // Width/height per frame (pixels)
-    int total_cols{1};                        // Total columns in sprite sheet
-    int total_rows{1};                        // Total rows in sprite sheet
-
-    // Animation clips (keyed by animation ID: IDLE=0, MOVING_UP=1, etc.)
-    std::unordered_map<int, AnimationClip> clips;
-
-    // Current playback state
-    int current_animation{0};     // Which animation is playing
-    int current_frame{0};         // Current frame index within animation
-    float frame_timer{0.0f};      // Time accumulator
-    bool finished{false};         // Animation completed (for non-looping)
-
-    // Priority system (some animations can't be interrupted)
-    bool priority_active{false};  // Is a priority animation playing?
-    int priority_id{-1};          // ID of priority animation
+    float frame_timer{0.0f};        // Time accumulator
+    uint16_t set{0};                // AnimationLibrary set handle (one per sprite sheet layout)
+    uint16_t clip{0xFFFF};          // Library clip playing, 0xFFFF = none
+    uint16_t current_frame{0};      // Current frame index within animation
+    uint16_t shown_frame{0xFFFF};   // Library frame last written to the Sprite
+    int16_t current_animation{0};   // Which animation is playing (IDLE=0, MOVING_UP=1, etc.)
+    int16_t priority_id{-1};        // ID of priority animation
+    bool loop{true};                // Loop or play once
+    bool finished{false};           // Animation completed (for non-looping)
+    bool priority_active{false};    // Is a priority animation playing? (can't be interrupted)
 };
 
 // Background component - for parallax scrolling stars
@@ -287,6 +294,25 @@ struct ParticleTag {};
 struct PowerupTag {};
 struct BackgroundTag {};
 
+// Pooled entity waiting in its pool, every system skips it
+struct Inactive {};
+
+// Entity owned by an EntityPool, destroying it returns it to the pool instead
+struct Pooled {
+    uint8_t pool{0};  // PoolId
+};
+
+// Size budgets for components walked by hot loops, raise them deliberately
+static_assert(sizeof(Transform) <= 24, "Transform is read by every movement and collision loop");
+static_assert(sizeof(Collision) <= 32, "Collision should stay two per cache line");
+static_assert(sizeof(Lifetime) <= 8, "Lifetime is walked for every bullet and particle");
+static_assert(sizeof(Homing) <= 16, "Homing is carried by every pooled bullet");
+static_assert(sizeof(Animation) <= 20, "Animation state only, clips live in the AnimationLibrary");
+static_assert(sizeof(AI) <= 32, "AI is walked for every enemy each tick");
+static_assert(sizeof(Weapon) <= 48, "Weapon should stay free of heap members");
+static_assert(sizeof(Movement) <= 64, "Movement should fit one cache line");
+static_assert(sizeof(Sprite) <= 64, "Sprite should fit one cache line");
+
 } // namespace ecs
 
 #endif // ECS_COMPONENTS_H
@@ -83,9 +83,22 @@ bool ConfigLoader::LoadWeapons(const std::string& filepath) {
                 wc.bullet_color = sf::Color::White;
             }
 
-            weapons[weapon_name] = wc;
+            if (auto node = weapon_table->get("range")) {
+                wc.range = node->value_or(800.0f);
+            } else {
+                wc.range = 800.0f;
+            }
+
+            // Reloading a weapon keeps its handle
+            auto [it, inserted] = weapon_handles.try_emplace(weapon_name, static_cast<WeaponHandle>(weapons.size()));
+            if (inserted) {
+                weapons.push_back(wc);
+            } else {
+                weapons[static_cast<size_t>(it->second)] = wc;
+            }
         }
 
+        ResolveHandles();
         std::cout << "Loaded " << weapons.size() << " weapons from " << filepath << std::endl;
         return true;
 
@@ -224,10 +237,16 @@ bool ConfigLoader::LoadEnemies(const std::string& filepath) {
             // Parse animation configuration
             ec.animation = ParseAnimation(*enemy_table);
 
-            enemies[enemy_name] = ec;
+            auto [it, inserted] = enemy_handles.try_emplace(enemy_name, static_cast<EnemyHandle>(enemies.size()));
+            if (inserted) {
+                enemies.push_back(ec);
+            } else {
+                enemies[static_cast<size_t>(it->second)] = ec;
+            }
             std::cout << "[ConfigLoader]   ✓ " << enemy_name << " loaded" << std::endl;
         }
 
+        ResolveHandles();
         std::cout << "Loaded " << enemies.size() << " enemies from " << filepath << std::endl;
         return true;
 
@@ -288,6 +307,7 @@ bool ConfigLoader::LoadConstants(const std::string& filepath) {
             if (auto node = game->get("max_bullets")) constants.max_bullets = node->value_or(1000);
             if (auto node = game->get("max_enemies")) constants.max_enemies = node->value_or(100);
             if (auto node = game->get("max_particles")) constants.max_particles = node->value_or(500);
+            if (auto node = game->get("max_beams")) constants.max_beams = node->value_or(32);
             if (auto node = game->get("world_speed")) constants.world_speed = node->value_or(100.0f);
         }
 
@@ -309,12 +329,39 @@ bool ConfigLoader::LoadConstants(const std::string& filepath) {
             if (auto node = layers->get("powerup")) constants.layer_powerup = node->value_or(0x10);
         }
 
+        // Collision matrix - layer pairs the broad phase is allowed to pair
+        if (auto matrix = config["collision_matrix"].as_table()) {
+            if (auto pairs_node = matrix->get("pairs")) {
+                if (auto pairs = pairs_node->as_array()) {
+                    constants.collision_matrix.clear();
+                    for (const auto& pair_node : *pairs) {
+                        auto pair = pair_node.as_array();
+                        if (!pair || pair->size() < 2) {
+                            continue;
+                        }
+
+                        std::string name_a{pair->get(0)->value_or("")};
+                        std::string name_b{pair->get(1)->value_or("")};
+                        uint32_t layer_a = ParseLayerName(name_a, constants);
+                        uint32_t layer_b = ParseLayerName(name_b, constants);
+                        if (layer_a == 0 || layer_b == 0) {
+                            std::cerr << "Unknown layer in collision_matrix pair ["
+                                      << name_a << ", " << name_b << "], skipping" << std::endl;
+                            continue;
+                        }
+                        constants.collision_matrix.emplace_back(layer_a, layer_b);
+                    }
+                }
+            }
+        }
+
         // Debug
         if (auto debug = config["debug"].as_table()) {
             if (auto node = debug->get("show_collision_shapes")) constants.debug_show_collision_shapes = node->value_or(false);
             if (auto node = debug->get("show_fps")) constants.debug_show_fps = node->value_or(true);
             if (auto node = debug->get("show_entity_count")) constants.debug_show_entity_count = node->value_or(true);
             if (auto node = debug->get("god_mode")) constants.debug_god_mode = node->value_or(false);
+            if (auto node = debug->get("show_system_timings")) constants.debug_show_system_timings = node->value_or(false);
         }
 
         // Performance
@@ -322,6 +369,9 @@ bool ConfigLoader::LoadConstants(const std::string& filepath) {
             if (auto node = perf->get("use_spatial_partitioning")) constants.use_spatial_partitioning = node->value_or(true);
             if (auto node = perf->get("quadtree_max_depth")) constants.quadtree_max_depth = node->value_or(6);
             if (auto node = perf->get("quadtree_max_objects")) constants.quadtree_max_objects = node->value_or(10);
+            if (auto node = perf->get("collision_cell_size")) constants.collision_cell_size = node->value_or(64.0f);
+            if (auto node = perf->get("collision_threads")) constants.collision_threads = node->value_or(1);
+            if (auto node = perf->get("query_cell_size")) constants.query_cell_size = node->value_or(128.0f);
         }
 
         std::cout << "Loaded constants from " << filepath << std::endl;
@@ -371,40 +421,55 @@ bool ConfigLoader::LoadAll(const std::string& config_dir) {
     return success;
 }
 
-std::optional<WeaponConfig> ConfigLoader::GetWeapon(const std::string& name) const {
-    auto it = weapons.find(name);
-    if (it != weapons.end()) {
-        return it->second;
-    }
-    return std::nullopt;
+WeaponHandle ConfigLoader::FindWeapon(const std::string& name) const {
+    auto it = weapon_handles.find(name);
+    return it != weapon_handles.end() ? it->second : WeaponHandle::INVALID;
 }
 
-std::optional<EnemyConfig> ConfigLoader::GetEnemy(const std::string& name) const {
-    auto it = enemies.find(name);
-    if (it != enemies.end()) {
-        return it->second;
-    }
-    return std::nullopt;
+EnemyHandle ConfigLoader::FindEnemy(const std::string& name) const {
+    auto it = enemy_handles.find(name);
+    return it != enemy_handles.end() ? it->second : EnemyHandle::INVALID;
+}
+
+const WeaponConfig* ConfigLoader::GetWeapon(WeaponHandle handle) const {
+    auto index = static_cast<size_t>(handle);
+    return index < weapons.size() ? &weapons[index] : nullptr;
+}
+
+const EnemyConfig* ConfigLoader::GetEnemy(EnemyHandle handle) const {
+    auto index = static_cast<size_t>(handle);
+    return index < enemies.size() ? &enemies[index] : nullptr;
 }
 
 std::vector<std::string> ConfigLoader::ListWeapons() const {
-    std::vector<std::string> names;
-    names.reserve(weapons.size());
-    for (const auto& [name, _] : weapons) {
-        names.push_back(name);
+    // Table keys, in handle order
+    std::vector<std::string> names(weapons.size());
+    for (const auto& [name, handle] : weapon_handles) {
+        names[static_cast<size_t>(handle)] = name;
     }
     return names;
 }
 
 std::vector<std::string> ConfigLoader::ListEnemies() const {
-    std::vector<std::string> names;
-    names.reserve(enemies.size());
-    for (const auto& [name, _] : enemies) {
-        names.push_back(name);
+    // Table keys, in handle order
+    std::vector<std::string> names(enemies.size());
+    for (const auto& [name, handle] : enemy_handles) {
+        names[static_cast<size_t>(handle)] = name;
     }
     return names;
 }
 
+void ConfigLoader::ResolveHandles() {
+    // Files can load in any order, so this runs after each one
+    for (auto& enemy : enemies) {
+        enemy.weapon_handle = enemy.weapon.empty() ? WeaponHandle::INVALID : FindWeapon(enemy.weapon);
+    }
+    for (size_t i = 0; i < player_config.weapon_slots.size(); ++i) {
+        const auto& name = player_config.weapon_slots[i];
+        player_config.weapon_slot_handles[i] = name.empty() ? WeaponHandle::INVALID : FindWeapon(name);
+    }
+}
+
 Weapon::Type ConfigLoader::ParseWeaponType(const std::string& type_str) {
     if (type_str == "single_shot") return Weapon::Type::SINGLE_SHOT;
     if (type_str == "burst") return Weapon::Type::BURST;
@@ -439,6 +504,15 @@ sf::Color ConfigLoader::ParseColor(const toml::array& color_array) {
     return sf::Color::White;
 }
 
+uint32_t ConfigLoader::ParseLayerName(const std::string& name, const GameConstants& constants) {
+    if (name == "player") return constants.layer_player;
+    if (name == "enemy") return constants.layer_enemy;
+    if (name == "enemy_bullet") return constants.layer_enemy_bullet;
+    if (name == "player_bullet") return constants.layer_player_bullet;
+    if (name == "powerup") return constants.layer_powerup;
+    return 0;
+}
+
 sf::Vector2f ConfigLoader::ParseVector2f(const toml::array& vec_array) {
     if (vec_array.size() >= 2) {
         auto x_node = vec_array.get(0);
@@ -667,6 +741,7 @@ bool ConfigLoader::LoadPlayer(const std::string& filepath) {
             }
         }
 
+        ResolveHandles();
         std::cout << "Loaded player configuration from " << filepath << std::endl;
         return true;
 
@@ -5,12 +5,22 @@
 #include <string>
 #include <optional>
 #include <unordered_map>
+#include <vector>
+#include <utility>
 #include <array>
 #include <SFML/Graphics.hpp>
 #include "../components/components.h"
 
 namespace ecs {
 
+/**
+ * WeaponHandle / EnemyHandle - Dense indices into ConfigLoader's tables
+ * Names are resolved to handles once at load time, spawning just indexes
+ * arrays with them.
+ */
+enum class WeaponHandle : uint16_t { INVALID = 0xFFFF };
+enum class EnemyHandle : uint16_t { INVALID = 0xFFFF };
+
 /**
  * AnimationClipConfig - Configuration for a single animation clip
  */
@@ -58,6 +68,7 @@ struct WeaponConfig {
     float spread_angle;
     sf::Vector2f bullet_size;
     sf::Color bullet_color;
+    float range;  // Beam weapons only
 };
 
 /**
@@ -84,6 +95,9 @@ struct PlayerConfig {
 
     // Multi-weapon system (ECS)
     std::array<std::string, 4> weapon_slots{};  // Weapon names for slots 1-4
+    std::array<WeaponHandle, 4> weapon_slot_handles{
+        WeaponHandle::INVALID, WeaponHandle::INVALID, WeaponHandle::INVALID, WeaponHandle::INVALID
+    };  // Resolved from weapon_slots
 };
 
 /**
@@ -100,6 +114,7 @@ struct EnemyConfig {
     float orbit_radius{0.0f};
     float orbit_speed{0.0f};
     std::string weapon;
+    WeaponHandle weapon_handle{WeaponHandle::INVALID};  // Resolved from weapon
     float score_value;
     sf::Vector2f size;
     float collision_radius;
@@ -136,6 +151,7 @@ struct GameConstants {
     int max_bullets{1000};
     int max_enemies{100};
     int max_particles{500};
+    int max_beams{32};
     float world_speed{100.0f};  // Gradius-style background scroll speed (px/s)
 
     // Bounds
@@ -152,16 +168,23 @@ struct GameConstants {
     uint32_t layer_player_bullet{0x08};
     uint32_t layer_powerup{0x10};
 
+    // Collision matrix - layer pairs tested by the broad phase (empty = all pairs)
+    std::vector<std::pair<uint32_t, uint32_t>> collision_matrix;
+
     // Debug
     bool debug_show_collision_shapes{false};
     bool debug_show_fps{true};
     bool debug_show_entity_count{true};
     bool debug_god_mode{false};
+    bool debug_show_system_timings{false};  // Print the scheduler breakdown once a second
 
     // Performance
     bool use_spatial_partitioning{true};
     int quadtree_max_depth{6};
     int quadtree_max_objects{10};
+    float collision_cell_size{64.0f};  // Spatial hash grid cell size (px)
+    int collision_threads{1};  // Collision detection workers, 1 = main thread only
+    float query_cell_size{128.0f};  // Spatial query index cell size (px)
 };
 
 /**
@@ -181,11 +204,21 @@ public:
     // Load all configs from directory
     bool LoadAll(const std::string& config_dir = "config");
 
-    // Get weapon config by name
-    std::optional<WeaponConfig> GetWeapon(const std::string& name) const;
+    // Resolve a name to its handle, INVALID if unknown (load time, hashes the name)
+    WeaponHandle FindWeapon(const std::string& name) const;
+    EnemyHandle FindEnemy(const std::string& name) const;
 
-    // Get enemy config by name
-    std::optional<EnemyConfig> GetEnemy(const std::string& name) const;
+    // Get config by handle, nullptr for INVALID
+    const WeaponConfig* GetWeapon(WeaponHandle handle) const;
+    const EnemyConfig* GetEnemy(EnemyHandle handle) const;
+
+    // Get config by name, nullptr if unknown
+    const WeaponConfig* GetWeapon(const std::string& name) const { return GetWeapon(FindWeapon(name)); }
+    const EnemyConfig* GetEnemy(const std::string& name) const { return GetEnemy(FindEnemy(name)); }
+
+    // Handles run 0..count-1 in load order
+    size_t GetWeaponCount() const { return weapons.size(); }
+    size_t GetEnemyCount() const { return enemies.size(); }
 
     // Get game constants
     const GameConstants& GetConstants() const { return constants; }
@@ -198,16 +231,22 @@ public:
     std::vector<std::string> ListEnemies() const;
 
 private:
-    std::unordered_map<std::string, WeaponConfig> weapons;
-    std::unordered_map<std::string, EnemyConfig> enemies;
+    std::vector<WeaponConfig> weapons;  // Indexed by WeaponHandle
+    std::vector<EnemyConfig> enemies;  // Indexed by EnemyHandle
+    std::unordered_map<std::string, WeaponHandle> weapon_handles;
+    std::unordered_map<std::string, EnemyHandle> enemy_handles;
     PlayerConfig player_config;
     GameConstants constants;
 
+    // Helper to fill in the weapon handles enemies and the player refer to by name
+    void ResolveHandles();
+
     // Helper methods
     static Weapon::Type ParseWeaponType(const std::string& type_str);
     static Movement::Pattern ParseMovementPattern(const std::string& pattern_str);
     static sf::Color ParseColor(const toml::array& color_array);
     static sf::Vector2f ParseVector2f(const toml::array& vec_array);
+    static uint32_t ParseLayerName(const std::string& name, const GameConstants& constants);
     static AnimationConfig ParseAnimation(const toml::table& entity_table);
     static PlayerPartConfig ParsePlayerPart(const toml::table& part_table);
 };
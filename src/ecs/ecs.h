@@ -6,6 +6,7 @@
 #include "world.h"
 #include "components/components.h"
 #include "systems/systems.h"
+#include "scheduler/system_scheduler.h"
 
 // Convenience namespace alias
 namespace ecs {
@@ -6,6 +6,35 @@
 
 namespace ecs {
 
+void EntityFactory::ReservePools() {
+    const auto& constants = config.GetConstants();
+
+    // Every component a bullet can use, CreateBullet only rewrites the data
+    world.ReservePool(PoolId::BULLET, constants.max_bullets, [&](entt::entity entity) {
+        world.AddComponent<Transform>(entity);
+        world.AddComponent<Sprite>(entity);
+        world.AddComponent<Glow>(entity);
+        world.AddComponent<Collision>(entity);
+        world.AddComponent<Homing>(entity, Homing{.range = 0.0f});
+        world.AddComponent<Lifetime>(entity);
+        world.AddComponent<BulletTag>(entity);
+    });
+
+    world.ReservePool(PoolId::PARTICLE, constants.max_particles, [&](entt::entity entity) {
+        world.AddComponent<Transform>(entity);
+        world.AddComponent<Sprite>(entity);
+        world.AddComponent<Glow>(entity);
+        world.AddComponent<Lifetime>(entity);
+        world.AddComponent<ParticleTag>(entity);
+    });
+
+    world.ReservePool(PoolId::BEAM, constants.max_beams, [&](entt::entity entity) {
+        world.AddComponent<Transform>(entity);
+        world.AddComponent<Sprite>(entity);
+        world.AddComponent<Lifetime>(entity);
+    });
+}
+
 entt::entity EntityFactory::CreatePlayer(sf::Vector2f position, sf::Texture* texture) {
     const auto& constants = config.GetConstants();
     const auto& player_cfg = config.GetPlayerConfig().ship;  // Load from player.toml!
@@ -14,7 +43,7 @@ entt::entity EntityFactory::CreatePlayer(sf::Vector2f position, sf::Texture* tex
 
     // Get texture from config if textureAtlas is available
     if (!texture && textureAtlas) {
-        texture = textureAtlas->GetTexture(player_cfg.sprite_sheet).get();
+        texture = textureAtlas->Resolve(textureAtlas->FindTexture(player_cfg.sprite_sheet));
     }
 
     // Calculate scale factor from desired size vs actual sprite size
@@ -26,9 +55,7 @@ entt::entity EntityFactory::CreatePlayer(sf::Vector2f position, sf::Texture* tex
     world.AddComponent<Transform>(entity, Transform{
         .position = position,
         .last_position = position,
-        .velocity = {0.0f, 0.0f},
-        .rotation = 0.0f,
-        .scale = scale  // 3x scale (8x8 → 24x24)
+        .velocity = {0.0f, 0.0f}
     });
 
     // Use direct pixel coordinates from config
@@ -47,6 +74,8 @@ entt::entity EntityFactory::CreatePlayer(sf::Vector2f position, sf::Texture* tex
         .color = sf::Color::White,
         .size = sf::Vector2f(frame_size.x, frame_size.y),  // Actual sprite size (8x8)
         .origin = sf::Vector2f(frame_size.x / 2.0f, frame_size.y / 2.0f),  // Center (4,4)
+        .rotation = 0.0f,
+        .scale = scale,  // 3x scale (8x8 → 24x24)
         .layer = 10,
         .visible = true
     });
@@ -69,10 +98,10 @@ entt::entity EntityFactory::CreatePlayer(sf::Vector2f position, sf::Texture* tex
 
     // Collision
     world.AddComponent<Collision>(entity, Collision{
-        .shape = Collision::Shape::CIRCLE,
         .radius = constants.player_collision_radius,
         .layer = constants.layer_player,
-        .mask = constants.layer_enemy | constants.layer_enemy_bullet
+        .mask = constants.layer_enemy | constants.layer_enemy_bullet,
+        .shape = Collision::Shape::CIRCLE
     });
 
     // Input
@@ -91,16 +120,17 @@ entt::entity EntityFactory::CreatePlayer(sf::Vector2f position, sf::Texture* tex
 
     // Add multi-weapon system (4 slots loaded from player.toml)
     const auto& weapon_slots = config.GetPlayerConfig().weapon_slots;
+    const auto& weapon_slot_handles = config.GetPlayerConfig().weapon_slot_handles;
     Weapons weapons_component;
 
     for (int i = 0; i < 4; ++i) {
         const std::string& weapon_name = weapon_slots[i];
         if (!weapon_name.empty()) {
-            if (auto weapon_cfg = config.GetWeapon(weapon_name)) {
+            if (const auto* weapon_cfg = config.GetWeapon(weapon_slot_handles[i])) {
                 Weapon weapon = CreateWeaponFromConfig(*weapon_cfg);
                 weapon.slot = i;  // Set slot number (0-3, displayed as 1-4 to user)
                 weapon.active = (i == 0);  // Slot 1 active by default, others inactive
-                weapons_component.slots[i] = weapon;
+                weapons_component.Equip(i, weapon);
             } else {
                 std::cerr << "Warning: Weapon '" << weapon_name << "' not found in weapons.toml for slot " << (i+1) << std::endl;
             }
@@ -112,22 +142,29 @@ entt::entity EntityFactory::CreatePlayer(sf::Vector2f position, sf::Texture* tex
     return entity;
 }
 
-entt::entity EntityFactory::CreateEnemy(const std::string& enemy_type,
-                                       sf::Vector2f position, sf::Texture* texture) {
-    auto enemy_cfg = config.GetEnemy(enemy_type);
-    if (!enemy_cfg) {
-        std::cerr << "Unknown enemy type: " << enemy_type << std::endl;
-        return entt::null;
+void EntityFactory::CompilePrefabs() {
+    prefabs.clear();
+    prefabs.reserve(config.GetEnemyCount());
+    for (size_t i = 0; i < config.GetEnemyCount(); ++i) {
+        prefabs.push_back(CompileEnemyPrefab(*config.GetEnemy(static_cast<EnemyHandle>(i))));
     }
+}
+
+const EnemyPrefab* EntityFactory::GetPrefab(EnemyHandle enemy_type) const {
+    auto index = static_cast<size_t>(enemy_type);
+    return index < prefabs.size() ? &prefabs[index] : nullptr;
+}
 
-    const auto& ec = *enemy_cfg;
+EnemyPrefab EntityFactory::CompileEnemyPrefab(const EnemyConfig& ec) {
     const auto& constants = config.GetConstants();
 
-    auto entity = world.CreateEntity();
+    EnemyPrefab prefab;
+    prefab.name = ec.name;
 
-    // Get texture from config if textureAtlas is available and no texture provided
-    if (!texture && textureAtlas && !ec.animation.sprite_sheet_name.empty()) {
-        texture = textureAtlas->GetTexture(ec.animation.sprite_sheet_name).get();
+    // Get texture from config if textureAtlas is available
+    sf::Texture* texture = nullptr;
+    if (textureAtlas && !ec.animation.sprite_sheet_name.empty()) {
+        texture = textureAtlas->Resolve(textureAtlas->FindTexture(ec.animation.sprite_sheet_name));
     }
 
     // Calculate scale factor from desired size vs actual sprite size
@@ -135,14 +172,12 @@ entt::entity EntityFactory::CreateEnemy(const std::string& enemy_type,
     float scale_y = ec.size.y / static_cast<float>(ec.animation.sprite_height);
     float scale = std::max(scale_x, scale_y);  // Use uniform scale (larger of the two)
 
-    // Transform
-    world.AddComponent<Transform>(entity, Transform{
-        .position = position,
-        .last_position = position,
-        .velocity = {0.0f, 0.0f},
-        .rotation = 0.0f,
-        .scale = scale  // Scale sprite from 8x8→24x24 or 16x16→48x48
-    });
+    // Transform (position is filled in per spawn)
+    prefab.transform = Transform{
+        .position = {0.0f, 0.0f},
+        .last_position = {0.0f, 0.0f},
+        .velocity = {0.0f, 0.0f}
+    };
 
     // Use direct pixel coordinates from config (supports non-uniform sprite sheets)
     sf::Vector2i frame_size(ec.animation.sprite_width, ec.animation.sprite_height);
@@ -155,36 +190,38 @@ entt::entity EntityFactory::CreateEnemy(const std::string& enemy_type,
 
     // Sprite (use White for textured sprites so texture colors show properly!)
     // Note: origin is in sprite-space (not scaled), size is the actual sprite size
-    world.AddComponent<Sprite>(entity, Sprite{
+    prefab.sprite = Sprite{
         .texture = texture,
         .texture_rect = texture_rect,  // Use calculated rect based on sprite_x/sprite_y
         .color = texture ? sf::Color::White : ec.color,  // White = use sprite colors, fallback to config color
         .size = sf::Vector2f(frame_size.x, frame_size.y),  // Actual sprite size (8x8 or 16x16)
         .origin = sf::Vector2f(frame_size.x / 2.0f, frame_size.y / 2.0f),  // Center origin (4,4 or 8,8)
+        .rotation = 0.0f,
+        .scale = scale,  // Scale sprite from 8x8→24x24 or 16x16→48x48
         .layer = 5,
         .visible = true
-    });
+    };
 
     // Animation (if animation config exists) - fully data-driven from TOML!
     // Skip animation for static sprites that use direct pixel coordinates
     bool uses_direct_coords = (ec.animation.sprite_x != 0 || ec.animation.sprite_y != 0);
 
     if (!uses_direct_coords && !ec.animation.clips.empty()) {
-        world.AddComponent<Animation>(entity, CreateAnimationFromConfig(ec.animation, texture));
+        prefab.animation = CreateAnimationFromConfig(ec.animation, texture);
     }
     // Note: Static sprites (with sprite_x/sprite_y set) won't get Animation component
     // Their texture_rect is set once and never changes
 
     // Health
-    world.AddComponent<Health>(entity, Health{
+    prefab.health = Health{
         .current = ec.health,
         .maximum = ec.health,
         .shield = 0.0f,
         .shield_maximum = 0.0f
-    });
+    };
 
     // Movement
-    world.AddComponent<Movement>(entity, Movement{
+    prefab.movement = Movement{
         .pattern = ec.movement_pattern,
         .speed = ec.movement_speed,
         .max_speed = ec.movement_speed * 1.5f,
@@ -193,49 +230,132 @@ entt::entity EntityFactory::CreateEnemy(const std::string& enemy_type,
         .sine_amplitude = ec.sine_amplitude,
         .sine_frequency = ec.sine_frequency,
         .direction = ec.direction,
-        .world_speed = constants.world_speed  // Gradius-style background scrolling
-    });
+        .world_speed = constants.world_speed,  // Gradius-style background scrolling
+        .target_mask = constants.layer_player
+    };
 
     // Collision
-    world.AddComponent<Collision>(entity, Collision{
-        .shape = Collision::Shape::CIRCLE,
+    prefab.collision = Collision{
         .radius = ec.collision_radius,
         .layer = constants.layer_enemy,
-        .mask = constants.layer_player | constants.layer_player_bullet
-    });
+        .mask = constants.layer_player | constants.layer_player_bullet,
+        .shape = Collision::Shape::CIRCLE
+    };
 
     // Score
-    world.AddComponent<Score>(entity, Score{
+    prefab.score = Score{
         .value = ec.score_value
-    });
+    };
+
+    // Chasers get an AI so AISystem picks their target, FOLLOW_TARGET steers toward it
+    // Detection covers the whole play area, the same reach as the untargeted fallback
+    if (ec.movement_pattern == Movement::Pattern::FOLLOW_TARGET) {
+        float width = constants.bounds_max_x - constants.bounds_min_x;
+        float height = constants.bounds_max_y - constants.bounds_min_y;
+        prefab.ai = AI{
+            .detection_range = std::sqrt(width * width + height * height),
+            .attack_range = ec.collision_radius * 2.0f,
+            .target_mask = constants.layer_player
+        };
+    }
 
     // Add weapon if configured
-    if (!ec.weapon.empty()) {
-        if (auto weapon_cfg = config.GetWeapon(ec.weapon)) {
-            world.AddComponent<Weapon>(entity, CreateWeaponFromConfig(*weapon_cfg));
-        }
+    if (const auto* weapon_cfg = config.GetWeapon(ec.weapon_handle)) {
+        prefab.weapon = CreateWeaponFromConfig(*weapon_cfg);
+    }
+
+    return prefab;
+}
+
+void EntityFactory::SpawnBatch(const EnemyPrefab& prefab, std::span<const sf::Vector2f> positions,
+                               std::vector<entt::entity>& spawned) {
+    if (positions.empty()) {
+        return;
+    }
+
+    // Range create, then each component inserted for the whole batch at once
+    size_t offset = spawned.size();
+    spawned.resize(offset + positions.size());
+    auto first = spawned.begin() + offset;
+    auto last = spawned.end();
+    world.CreateEntities(first, last);
+
+    batch_transforms.clear();
+    for (const auto& position : positions) {
+        auto& transform = batch_transforms.emplace_back(prefab.transform);
+        transform.position = position;
+        transform.last_position = position;
+    }
+    world.InsertComponentsFrom<Transform>(first, last, batch_transforms.begin());
+
+    world.InsertComponents<Sprite>(first, last, prefab.sprite);
+    if (prefab.animation) {
+        world.InsertComponents<Animation>(first, last, *prefab.animation);
+    }
+    world.InsertComponents<Health>(first, last, prefab.health);
+    world.InsertComponents<Movement>(first, last, prefab.movement);
+    world.InsertComponents<Collision>(first, last, prefab.collision);
+    world.InsertComponents<Score>(first, last, prefab.score);
+    if (prefab.weapon) {
+        world.InsertComponents<Weapon>(first, last, *prefab.weapon);
+    }
+    if (prefab.ai) {
+        world.InsertComponents<AI>(first, last, *prefab.ai);
+    }
+    world.InsertComponents<EnemyTag>(first, last);
+}
+
+entt::entity EntityFactory::CreateEnemy(const std::string& enemy_type,
+                                       sf::Vector2f position, sf::Texture* texture) {
+    auto handle = config.FindEnemy(enemy_type);
+    if (handle == EnemyHandle::INVALID) {
+        std::cerr << "Unknown enemy type: " << enemy_type << std::endl;
+        return entt::null;
+    }
+    return CreateEnemy(handle, position, texture);
+}
+
+entt::entity EntityFactory::CreateEnemy(EnemyHandle enemy_type,
+                                       sf::Vector2f position, sf::Texture* texture) {
+    const auto* prefab = GetPrefab(enemy_type);
+    if (!prefab) {
+        std::cerr << "Unknown enemy handle: " << static_cast<int>(enemy_type) << std::endl;
+        return entt::null;
     }
 
-    // Enemy tag
-    world.AddComponent<EnemyTag>(entity);
+    batch_entities.clear();
+    SpawnBatch(*prefab, std::span<const sf::Vector2f>(&position, 1), batch_entities);
+    auto entity = batch_entities.front();
+
+    // Explicit texture wins over the one resolved from the sprite sheet name
+    if (texture) {
+        world.PatchComponent<Sprite>(entity, [texture](Sprite& sprite) {
+            sprite.texture = texture;
+            sprite.color = sf::Color::White;
+        });
+    }
 
     return entity;
 }
 
-entt::entity EntityFactory::CreateBullet(const std::string& weapon_name,
+entt::entity EntityFactory::CreateBullet(WeaponHandle weapon,
                                         sf::Vector2f position, sf::Vector2f direction,
                                         entt::entity owner, bool is_player_bullet,
                                         sf::Texture* texture) {
-    auto weapon_cfg = config.GetWeapon(weapon_name);
+    const auto* weapon_cfg = config.GetWeapon(weapon);
     if (!weapon_cfg) {
-        std::cerr << "Unknown weapon: " << weapon_name << std::endl;
+        std::cerr << "Unknown weapon handle: " << static_cast<int>(weapon) << std::endl;
         return entt::null;
     }
 
     const auto& wc = *weapon_cfg;
     const auto& constants = config.GetConstants();
 
-    auto entity = world.CreateEntity();
+    // Reuse a pre-built entity, only its component data is rewritten
+    auto entity = world.AcquirePooled(PoolId::BULLET);
+    if (entity == entt::null) {
+        return entt::null;  // max_bullets already live
+    }
 
     // Normalize direction
     float length = std::sqrt(direction.x * direction.x + direction.y * direction.y);
@@ -244,47 +364,47 @@ entt::entity EntityFactory::CreateBullet(const std::string& weapon_name,
     }
 
     // Transform with velocity
-    world.AddComponent<Transform>(entity, Transform{
+    world.GetComponent<Transform>(entity) = Transform{
         .position = position,
         .last_position = position,
-        .velocity = direction * wc.bullet_speed,
-        .rotation = std::atan2(direction.x, -direction.y) * 180.0f / 3.14159f,
-        .scale = 1.0f
-    });
+        .velocity = direction * wc.bullet_speed
+    };
 
-    // Sprite
-    world.AddComponent<Sprite>(entity, Sprite{
+    // Sprite (replaced, not assigned, so the render queue sees layer / texture changes)
+    world.ReplaceComponent<Sprite>(entity, Sprite{
         .texture = texture,
         .color = wc.bullet_color,
         .size = wc.bullet_size,
         .origin = wc.bullet_size * 0.5f,
+        .rotation = std::atan2(direction.x, -direction.y) * 180.0f / 3.14159f,
+        .scale = 1.0f,
         .layer = is_player_bullet ? 8 : 3,
         .visible = true
     });
 
     // Glow effect
-    world.AddComponent<Glow>(entity, Glow{
+    world.GetComponent<Glow>(entity) = Glow{
         .color = wc.bullet_color,
         .attenuation = 300.0f,  // Higher value = tighter glow (legacy uses 500.0f)
         .enabled = true
-    });
+    };
 
     // Collision
-    world.AddComponent<Collision>(entity, Collision{
-        .shape = Collision::Shape::CIRCLE,
+    world.GetComponent<Collision>(entity) = Collision{
         .radius = std::min(wc.bullet_size.x, wc.bullet_size.y) * 0.5f,
         .layer = is_player_bullet ? constants.layer_player_bullet : constants.layer_enemy_bullet,
-        .mask = is_player_bullet ? constants.layer_enemy : constants.layer_player
-    });
+        .mask = is_player_bullet ? constants.layer_enemy : constants.layer_player,
+        .shape = Collision::Shape::CIRCLE
+    };
+
+    // Weapon bullets fly straight, clear any homing left by the pooled entity's last use
+    world.GetComponent<Homing>(entity) = Homing{.range = 0.0f};
 
     // Lifetime (bullets despawn after 5 seconds)
-    world.AddComponent<Lifetime>(entity, Lifetime{
+    world.GetComponent<Lifetime>(entity) = Lifetime{
         .duration = 5.0f,
         .elapsed = 0.0f
-    });
-
-    // Bullet tag
-    world.AddComponent<BulletTag>(entity);
+    };
 
     return entity;
 }
@@ -293,7 +413,11 @@ entt::entity EntityFactory::CreateBullet(const BulletSpawnRequest& request,
                                         bool is_player_bullet, sf::Texture* texture) {
     const auto& constants = config.GetConstants();
 
-    auto entity = world.CreateEntity();
+    // Reuse a pre-built entity, only its component data is rewritten
+    auto entity = world.AcquirePooled(PoolId::BULLET);
+    if (entity == entt::null) {
+        return entt::null;  // max_bullets already live
+    }
 
     // Normalize direction
     sf::Vector2f direction = request.direction;
@@ -303,110 +427,158 @@ entt::entity EntityFactory::CreateBullet(const BulletSpawnRequest& request,
     }
 
     // Transform with velocity
-    world.AddComponent<Transform>(entity, Transform{
+    world.GetComponent<Transform>(entity) = Transform{
         .position = request.position,
         .last_position = request.position,
-        .velocity = direction * request.speed,
-        .rotation = std::atan2(direction.x, -direction.y) * 180.0f / 3.14159f,
-        .scale = 1.0f
-    });
+        .velocity = direction * request.speed
+    };
 
-    // Sprite
-    world.AddComponent<Sprite>(entity, Sprite{
+    // Sprite (replaced, not assigned, so the render queue sees layer / texture changes)
+    world.ReplaceComponent<Sprite>(entity, Sprite{
         .texture = texture,
         .color = request.color,
         .size = request.size,
         .origin = request.size * 0.5f,
+        .rotation = std::atan2(direction.x, -direction.y) * 180.0f / 3.14159f,
+        .scale = 1.0f,
         .layer = is_player_bullet ? 8 : 3,
         .visible = true
     });
 
     // Glow effect
-    world.AddComponent<Glow>(entity, Glow{
+    world.GetComponent<Glow>(entity) = Glow{
         .color = request.color,
         .attenuation = 300.0f,  // Higher value = tighter glow (legacy uses 500.0f)
         .enabled = true
-    });
+    };
 
     // Collision
-    world.AddComponent<Collision>(entity, Collision{
-        .shape = Collision::Shape::CIRCLE,
+    world.GetComponent<Collision>(entity) = Collision{
         .radius = std::min(request.size.x, request.size.y) * 0.5f,
         .layer = is_player_bullet ? constants.layer_player_bullet : constants.layer_enemy_bullet,
-        .mask = is_player_bullet ? constants.layer_enemy : constants.layer_player
-    });
+        .mask = is_player_bullet ? constants.layer_enemy : constants.layer_player,
+        .shape = Collision::Shape::CIRCLE
+    };
+
+    // Homing bullets steer toward whatever they can hit, zero range flies straight
+    world.GetComponent<Homing>(entity) = Homing{
+        .range = request.homing_range,
+        .target_mask = is_player_bullet ? constants.layer_enemy : constants.layer_player
+    };
 
     // Lifetime
-    world.AddComponent<Lifetime>(entity, Lifetime{
+    world.GetComponent<Lifetime>(entity) = Lifetime{
         .duration = 5.0f,
         .elapsed = 0.0f
+    };
+
+    return entity;
+}
+
+entt::entity EntityFactory::CreateBeam(sf::Vector2f origin, sf::Vector2f direction, float length,
+                                      sf::Color color, float width, float lifetime) {
+    // Reuse a pre-built entity, held fire re-shoots every cooldown
+    auto entity = world.AcquirePooled(PoolId::BEAM);
+    if (entity == entt::null) {
+        return entt::null;  // max_beams already live
+    }
+
+    // Centred on the beam, rotated like bullets so the sprite's height runs along it
+    sf::Vector2f centre = origin + direction * (length * 0.5f);
+    world.GetComponent<Transform>(entity) = Transform{
+        .position = centre,
+        .last_position = centre,
+        .velocity = {0.0f, 0.0f}
+    };
+
+    // Sprite (replaced, not assigned, so the render queue sees layer / texture changes)
+    world.ReplaceComponent<Sprite>(entity, Sprite{
+        .texture = nullptr,
+        .color = color,
+        .size = {width, length},
+        .origin = {width * 0.5f, length * 0.5f},
+        .rotation = std::atan2(direction.x, -direction.y) * 180.0f / 3.14159f,
+        .scale = 1.0f,
+        .layer = 8,
+        .visible = true
     });
 
-    // Bullet tag
-    world.AddComponent<BulletTag>(entity);
+    // Lifetime
+    world.GetComponent<Lifetime>(entity) = Lifetime{
+        .duration = lifetime,
+        .elapsed = 0.0f
+    };
 
     return entity;
 }
 
 entt::entity EntityFactory::CreateParticle(sf::Vector2f position, sf::Vector2f velocity,
                                           sf::Color color, float lifetime, float size) {
-    auto entity = world.CreateEntity();
+    // Reuse a pre-built entity, only its component data is rewritten
+    auto entity = world.AcquirePooled(PoolId::PARTICLE);
+    if (entity == entt::null) {
+        return entt::null;  // max_particles already live
+    }
 
+    InitParticle(entity, position, velocity, color, lifetime, size);
+    return entity;
+}
+
+void EntityFactory::InitParticle(entt::entity entity, sf::Vector2f position, sf::Vector2f velocity,
+                                 sf::Color color, float lifetime, float size) {
     // Transform
-    world.AddComponent<Transform>(entity, Transform{
+    world.GetComponent<Transform>(entity) = Transform{
         .position = position,
         .last_position = position,
-        .velocity = velocity,
-        .rotation = 0.0f,
-        .scale = 1.0f
-    });
+        .velocity = velocity
+    };
 
-    // Sprite
-    world.AddComponent<Sprite>(entity, Sprite{
+    // Sprite (replaced, not assigned, so the render queue sees layer / texture changes)
+    world.ReplaceComponent<Sprite>(entity, Sprite{
         .texture = nullptr,
         .color = color,
         .size = {size, size},
         .origin = {size * 0.5f, size * 0.5f},
+        .rotation = 0.0f,
+        .scale = 1.0f,
         .layer = 1,
         .visible = true
     });
 
     // Glow effect for explosion particles
-    world.AddComponent<Glow>(entity, Glow{
+    world.GetComponent<Glow>(entity) = Glow{
         .color = color,
         .attenuation = 100.0f,  // Lower value = larger glow for explosions
         .enabled = true
-    });
+    };
 
     // Lifetime
-    world.AddComponent<Lifetime>(entity, Lifetime{
+    world.GetComponent<Lifetime>(entity) = Lifetime{
         .duration = lifetime,
         .elapsed = 0.0f
-    });
-
-    // Particle tag
-    world.AddComponent<ParticleTag>(entity);
-
-    return entity;
+    };
 }
 
 void EntityFactory::CreateExplosion(sf::Vector2f position, sf::Color color, int particle_count) {
-    const float TWO_PI = 6.28318f;
     const float speed = 150.0f;
     const float lifetime = 0.5f;
 
-    for (int i = 0; i < particle_count; ++i) {
+    // Whole burst reactivated in one pass, fewer particles if the pool runs low
+    batch_entities.clear();
+    world.AcquirePooled(PoolId::PARTICLE, static_cast<size_t>(std::max(particle_count, 0)), batch_entities);
+
+    for (auto entity : batch_entities) {
         auto theta = AngleConversion::ToRadians((float)randomSource->Generate(0, 360));
         sf::Vector2f velocity(std::cos(theta) * speed, std::sin(theta) * speed);
-        CreateParticle(position, velocity, color, lifetime, 4.0f);
+        InitParticle(entity, position, velocity, color, lifetime, 4.0f);
     }
 }
 
-Weapon EntityFactory::CreateWeaponFromConfig(const WeaponConfig& wc) {
+Weapon EntityFactory::CreateWeaponFromConfig(const WeaponConfig& wc) const {
     return Weapon{
         .type = wc.type,
-        .slot = 1,
         .active = true,
+        .slot = 1,
         .cooldown = wc.cooldown,
         .current_cooldown = 0.0f,
         .damage = wc.damage,
@@ -415,33 +587,34 @@ Weapon EntityFactory::CreateWeaponFromConfig(const WeaponConfig& wc) {
         .spread_angle = wc.spread_angle,
         .bullet_color = wc.bullet_color,
         .bullet_size = wc.bullet_size,
-        .script_id = ""
+        .range = wc.range
     };
 }
 
 Animation EntityFactory::CreateAnimationFromConfig(const AnimationConfig& anim_cfg, sf::Texture* texture) {
-    Animation anim;
-
     // Use direct sprite dimensions from config (supports non-uniform sprite sheets)
     sf::Vector2i frame_size(anim_cfg.sprite_width, anim_cfg.sprite_height);
 
-    anim.frame_size = frame_size;
-    anim.total_cols = anim_cfg.cols;
-    anim.total_rows = anim_cfg.rows;
-    anim.current_animation = 0;  // Start with first animation
-    anim.current_frame = 0;
-    anim.frame_timer = 0.0f;
-    anim.finished = false;
-
-    // Add all animation clips from config
+    // Clips go into the shared library once, the component only keeps handles
+    std::vector<std::pair<int, AnimationClip>> clips;
+    clips.reserve(anim_cfg.clips.size());
     for (const auto& clip_cfg : anim_cfg.clips) {
-        anim.clips[clip_cfg.id] = AnimationClip{
+        clips.emplace_back(clip_cfg.id, AnimationClip{
             .row = clip_cfg.row,
             .start_col = clip_cfg.start_col,
             .frame_count = clip_cfg.frame_count,
             .frame_duration = clip_cfg.duration,
             .loop = clip_cfg.loop
-        };
+        });
+    }
+
+    auto& library = world.GetAnimationLibrary();
+    Animation anim;
+    anim.set = library.AddSet(frame_size, clips);
+    anim.current_animation = 0;  // Start with first animation
+    anim.clip = library.FindClip(anim.set, anim.current_animation);
+    if (anim.clip != AnimationLibrary::kNoClip) {
+        anim.loop = library.GetClip(anim.clip).loop;
     }
 
     return anim;
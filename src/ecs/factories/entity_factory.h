@@ -4,11 +4,15 @@
 #include "../world.h"
 #include "../config/config_loader.h"
 #include "../systems/weapon_system.h"
+#include "prefab.h"
 #include "util/i_texture_atlas.h"
 #include "util/i_random_number_source.h"
 #include <SFML/Graphics.hpp>
 #include <optional>
 #include <memory>
+#include <span>
+#include <string>
+#include <vector>
 
 namespace ecs {
 
@@ -23,15 +27,32 @@ public:
     // Set texture atlas for loading textures by name
     void SetTextureAtlas(std::shared_ptr<ITextureAtlas> atlas) { textureAtlas = atlas; }
 
+    // Pre-build the bullet, particle and beam pools (max_bullets / max_particles / max_beams), call once per world
+    void ReservePools();
+
     // Create player entity (loads texture from config if textureAtlas set)
     entt::entity CreatePlayer(sf::Vector2f position, sf::Texture* texture = nullptr);
 
-    // Create enemy entity from config
+    // Resolve every enemy type in enemies.toml into a prefab, call after SetTextureAtlas
+    void CompilePrefabs();
+
+    // Prefab for an enemy type, nullptr if unknown
+    const EnemyPrefab* GetPrefab(EnemyHandle enemy_type) const;
+
+    // Instantiate prefab once per position in one pass, new entities are appended to spawned
+    void SpawnBatch(const EnemyPrefab& prefab, std::span<const sf::Vector2f> positions,
+                    std::vector<entt::entity>& spawned);
+
+    // Create enemy entity from its prefab (texture overrides the prefab's)
+    entt::entity CreateEnemy(EnemyHandle enemy_type, sf::Vector2f position,
+                            sf::Texture* texture = nullptr);
+
+    // As above, resolving the type name first
     entt::entity CreateEnemy(const std::string& enemy_type, sf::Vector2f position,
                             sf::Texture* texture = nullptr);
 
-    // Create bullet entity from weapon config
-    entt::entity CreateBullet(const std::string& weapon_name, sf::Vector2f position,
+    // Create bullet entity from weapon config (pooled, entt::null when max_bullets are live)
+    entt::entity CreateBullet(WeaponHandle weapon, sf::Vector2f position,
                              sf::Vector2f direction, entt::entity owner,
                              bool is_player_bullet = true, sf::Texture* texture = nullptr);
 
@@ -39,11 +60,16 @@ public:
     entt::entity CreateBullet(const BulletSpawnRequest& request,
                              bool is_player_bullet = true, sf::Texture* texture = nullptr);
 
-    // Create particle effect
+    // Create beam visual from origin along direction (pooled, no collision, fades by lifetime)
+    // entt::null when max_beams are live
+    entt::entity CreateBeam(sf::Vector2f origin, sf::Vector2f direction, float length,
+                           sf::Color color, float width, float lifetime);
+
+    // Create particle effect (pooled, entt::null when max_particles are live)
     entt::entity CreateParticle(sf::Vector2f position, sf::Vector2f velocity,
                                sf::Color color, float lifetime, float size = 4.0f);
 
-    // Create explosion effect
+    // Create explosion effect, the particles are taken from the pool in one batch
     void CreateExplosion(sf::Vector2f position, sf::Color color = sf::Color::Red,
                         int particle_count = 16);
 
@@ -52,11 +78,23 @@ private:
     const ConfigLoader& config;
     std::shared_ptr<ITextureAtlas> textureAtlas;
     const std::unique_ptr<IRandomNumberSource<int>> randomSource;
+    std::vector<EnemyPrefab> prefabs;  // Indexed by EnemyHandle
+
+    // Scratch reused across batches
+    std::vector<Transform> batch_transforms;
+    std::vector<entt::entity> batch_entities;
+
+    // Helper to resolve one enemy config into its prefab
+    EnemyPrefab CompileEnemyPrefab(const EnemyConfig& ec);
+
+    // Helper to write a pooled particle's components
+    void InitParticle(entt::entity entity, sf::Vector2f position, sf::Vector2f velocity,
+                      sf::Color color, float lifetime, float size);
 
     // Helper to create weapon component from config
-    Weapon CreateWeaponFromConfig(const WeaponConfig& wc);
+    Weapon CreateWeaponFromConfig(const WeaponConfig& wc) const;
 
-    // Helper to create animation component from config
+    // Helper to register the config's clips in the world's AnimationLibrary and create a component playing clip 0
     Animation CreateAnimationFromConfig(const AnimationConfig& anim_cfg, sf::Texture* texture);
 };
 
@@ -0,0 +1,31 @@
+#ifndef ECS_PREFAB_H
+#define ECS_PREFAB_H
+
+#include "../components/components.h"
+#include <optional>
+#include <string>
+
+namespace ecs {
+
+/**
+ * EnemyPrefab - An enemy type resolved once into the components each spawn copies
+ * Built from enemies.toml by EntityFactory::CompilePrefabs: texture looked
+ * up, scale, rects and animation clips computed. Transform is left default,
+ * spawning fills in the position.
+ */
+struct EnemyPrefab {
+    std::string name;
+    Transform transform;
+    Sprite sprite;
+    std::optional<Animation> animation;  // Absent for static sprites (direct sprite_x / sprite_y)
+    Health health;
+    Movement movement;
+    Collision collision;
+    Score score;
+    std::optional<Weapon> weapon;
+    std::optional<AI> ai;  // Only enemies that chase a target (follow_target movement)
+};
+
+} // namespace ecs
+
+#endif // ECS_PREFAB_H
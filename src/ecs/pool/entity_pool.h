@@ -0,0 +1,83 @@
+#ifndef ECS_ENTITY_POOL_H
+#define ECS_ENTITY_POOL_H
+
+#include <entt/entt.hpp>
+#include "../components/components.h"
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+
+namespace ecs {
+
+enum class PoolId : uint8_t {
+    BULLET,
+    PARTICLE,
+    BEAM,
+    COUNT
+};
+
+/**
+ * EntityPool - Free list of pre-built entities of one archetype
+ * Entities are created once with every component the archetype needs and
+ * parked with the Inactive tag. Acquire hands one out by dropping the tag,
+ * the caller rewrites its component data in place. Release puts the tag
+ * back, so firing and exploding never create or destroy entities or
+ * touch any storage besides Inactive.
+ */
+class EntityPool {
+public:
+    // Take an inactive entity, entt::null when every entity is in use
+    entt::entity Acquire(entt::registry& registry) {
+        if (free.empty()) {
+            return entt::null;
+        }
+
+        auto entity = free.back();
+        free.pop_back();
+        registry.remove<Inactive>(entity);
+        return entity;
+    }
+
+    // Take up to count inactive entities in one pass, appended to out
+    void Acquire(entt::registry& registry, size_t count, std::vector<entt::entity>& out) {
+        count = std::min(count, free.size());
+        auto first = free.end() - static_cast<std::ptrdiff_t>(count);
+        registry.remove<Inactive>(first, free.end());
+        out.insert(out.end(), first, free.end());
+        free.erase(first, free.end());
+    }
+
+    // Releasing an entity that is already parked is a no-op, it must only sit on the free list once
+    void Release(entt::registry& registry, entt::entity entity) {
+        if (registry.all_of<Inactive>(entity)) {
+            return;
+        }
+        registry.emplace<Inactive>(entity);
+        free.push_back(entity);
+    }
+
+    // Adopt a freshly built entity, it starts inactive
+    void Add(entt::registry& registry, entt::entity entity, PoolId id) {
+        registry.emplace<Pooled>(entity, Pooled{static_cast<uint8_t>(id)});
+        Release(registry, entity);
+        capacity++;
+    }
+
+    // Forget all entities, for when the registry itself is cleared
+    void Clear() {
+        free.clear();
+        capacity = 0;
+    }
+
+    size_t GetCapacity() const { return capacity; }
+    size_t GetActiveCount() const { return capacity - free.size(); }
+
+private:
+    std::vector<entt::entity> free;
+    size_t capacity{0};
+};
+
+} // namespace ecs
+
+#endif // ECS_ENTITY_POOL_H
@@ -0,0 +1,201 @@
+#ifndef ECS_RENDER_QUEUE_H
+#define ECS_RENDER_QUEUE_H
+
+#include <entt/entt.hpp>
+#include <SFML/Graphics.hpp>
+#include "../components/components.h"
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include <functional>
+
+namespace ecs {
+
+/**
+ * DrawRecord - Everything needed to draw one sprite, packed per bucket
+ * Rewritten every frame from the entity's Transform and Sprite, the bucket
+ * already fixes the layer and texture.
+ */
+struct DrawRecord {
+    entt::entity entity{entt::null};
+    sf::Vector2f position;  // Interpolated render position
+    float rotation{0.0f};
+    float scale{1.0f};
+    sf::Vector2f size;
+    sf::Vector2f origin;
+    sf::IntRect texture_rect;
+    sf::Color color{sf::Color::White};
+    bool visible{false};  // Stays false until the first Write
+};
+
+/**
+ * RenderQueue - Persistent draw list bucketed by (layer, texture)
+ * Membership follows the Sprite and Inactive storages through registry
+ * signals: a sprite joins its bucket when constructed or reactivated, moves
+ * when an update changes its layer or texture and leaves when destroyed or
+ * parked. Buckets are kept in draw order (layer, then texture), so drawing
+ * is a straight walk with no per-frame sort.
+ *
+ * Layer and texture changes must go through registry.replace / patch
+ * (World::ReplaceComponent / PatchComponent) to be seen, other Sprite fields
+ * are picked up by the per-frame Write.
+ */
+class RenderQueue {
+public:
+    struct Bucket {
+        int layer;
+        const sf::Texture* texture;
+        std::vector<DrawRecord> records;
+    };
+
+    void Connect(entt::registry& registry) {
+        registry.on_construct<Sprite>().connect<&RenderQueue::OnSpriteConstruct>(*this);
+        registry.on_update<Sprite>().connect<&RenderQueue::OnSpriteUpdate>(*this);
+        registry.on_destroy<Sprite>().connect<&RenderQueue::OnSpriteDestroy>(*this);
+        registry.on_construct<Inactive>().connect<&RenderQueue::OnInactiveConstruct>(*this);
+        registry.on_destroy<Inactive>().connect<&RenderQueue::OnInactiveDestroy>(*this);
+    }
+
+    // Refresh an entity's record, safe from several threads for different entities
+    void Write(entt::entity entity, sf::Vector2f position, const Sprite& sprite) {
+        auto index = entt::to_entity(entity);
+        if (index >= locations.size() || locations[index].bucket == kNone) {
+            return;
+        }
+
+        const auto& location = locations[index];
+        auto& record = buckets[location.bucket].records[location.slot];
+        record.position = position;
+        record.rotation = sprite.rotation;
+        record.scale = sprite.scale;
+        record.size = sprite.size;
+        record.origin = sprite.origin;
+        record.texture_rect = sprite.texture_rect;
+        record.color = sprite.color;
+        record.visible = sprite.visible;
+    }
+
+    // fn(bucket) for every non-empty bucket, back to front
+    template<typename Fn>
+    void ForEach(Fn&& fn) const {
+        for (auto bucket : draw_order) {
+            if (!buckets[bucket].records.empty()) {
+                fn(buckets[bucket]);
+            }
+        }
+    }
+
+    size_t GetBucketCount() const { return buckets.size(); }
+
+    void Clear() {
+        buckets.clear();
+        draw_order.clear();
+        locations.clear();
+    }
+
+private:
+    static constexpr uint16_t kNone = 0xFFFF;
+
+    struct Location {
+        uint16_t bucket{kNone};
+        uint32_t slot{0};
+    };
+
+    void OnSpriteConstruct(entt::registry& registry, entt::entity entity) {
+        if (!registry.all_of<Inactive>(entity)) {
+            Insert(entity, registry.get<Sprite>(entity));
+        }
+    }
+
+    void OnSpriteUpdate(entt::registry& registry, entt::entity entity) {
+        if (registry.all_of<Inactive>(entity)) {
+            return;
+        }
+
+        const auto& sprite = registry.get<Sprite>(entity);
+        auto index = entt::to_entity(entity);
+        if (index < locations.size() && locations[index].bucket != kNone) {
+            const auto& bucket = buckets[locations[index].bucket];
+            if (bucket.layer == sprite.layer && bucket.texture == sprite.texture) {
+                return;
+            }
+            Erase(entity);
+        }
+        Insert(entity, sprite);
+    }
+
+    void OnSpriteDestroy(entt::registry&, entt::entity entity) {
+        Erase(entity);
+    }
+
+    void OnInactiveConstruct(entt::registry&, entt::entity entity) {
+        Erase(entity);
+    }
+
+    void OnInactiveDestroy(entt::registry& registry, entt::entity entity) {
+        if (const auto* sprite = registry.try_get<Sprite>(entity)) {
+            Insert(entity, *sprite);
+        }
+    }
+
+    void Insert(entt::entity entity, const Sprite& sprite) {
+        auto index = entt::to_entity(entity);
+        if (index >= locations.size()) {
+            locations.resize(index + 1);
+        }
+        if (locations[index].bucket != kNone) {
+            return;  // Already queued
+        }
+
+        auto bucket = FindOrAddBucket(sprite.layer, sprite.texture);
+        auto& records = buckets[bucket].records;
+        locations[index] = Location{bucket, static_cast<uint32_t>(records.size())};
+        records.push_back(DrawRecord{.entity = entity});
+    }
+
+    // Swap and pop, the moved record's location follows it
+    void Erase(entt::entity entity) {
+        auto index = entt::to_entity(entity);
+        if (index >= locations.size() || locations[index].bucket == kNone) {
+            return;
+        }
+
+        auto location = locations[index];
+        auto& records = buckets[location.bucket].records;
+        if (location.slot + 1 != records.size()) {
+            records[location.slot] = records.back();
+            locations[entt::to_entity(records[location.slot].entity)].slot = location.slot;
+        }
+        records.pop_back();
+        locations[index] = Location{};
+    }
+
+    // Buckets are never removed, a layer / texture pair stays cheap to revisit
+    uint16_t FindOrAddBucket(int layer, const sf::Texture* texture) {
+        for (uint16_t i = 0; i < buckets.size(); ++i) {
+            if (buckets[i].layer == layer && buckets[i].texture == texture) {
+                return i;
+            }
+        }
+
+        auto id = static_cast<uint16_t>(buckets.size());
+        buckets.push_back(Bucket{layer, texture, {}});
+
+        auto before = [this](uint16_t a, uint16_t b) {
+            if (buckets[a].layer != buckets[b].layer) {
+                return buckets[a].layer < buckets[b].layer;
+            }
+            return std::less<const sf::Texture*>{}(buckets[a].texture, buckets[b].texture);
+        };
+        draw_order.insert(std::upper_bound(draw_order.begin(), draw_order.end(), id, before), id);
+        return id;
+    }
+
+    std::vector<Bucket> buckets;  // Stable indices, Location refers to them
+    std::vector<uint16_t> draw_order;  // Bucket indices sorted by (layer, texture)
+    std::vector<Location> locations;  // Indexed by entity index
+};
+
+} // namespace ecs
+
+#endif // ECS_RENDER_QUEUE_H
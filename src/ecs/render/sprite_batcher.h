@@ -0,0 +1,101 @@
+#ifndef ECS_SPRITE_BATCHER_H
+#define ECS_SPRITE_BATCHER_H
+
+#include <SFML/Graphics.hpp>
+#include "render_queue.h"
+#include <cmath>
+#include <cstddef>
+
+namespace ecs {
+
+/**
+ * SpriteBatcher - Draws a RenderQueue bucket as one vertex array
+ * Every visible record becomes a transformed quad (two triangles) with the
+ * same maths sf::Sprite / sf::RectangleShape use: translate to position,
+ * rotate, scale, then offset by the origin. Textured quads take their UVs
+ * from texture_rect, untextured ones are solid colour quads drawn without a
+ * texture. One draw call per bucket, the vertex array keeps its capacity
+ * between frames.
+ */
+class SpriteBatcher {
+public:
+    SpriteBatcher() : vertices(sf::Triangles) {}
+
+    // Start of a frame, resets the draw call count
+    void Begin() {
+        draw_calls = 0;
+    }
+
+    void Draw(sf::RenderTarget& target, const RenderQueue::Bucket& bucket) {
+        vertices.resize(bucket.records.size() * 6);
+
+        size_t count = 0;
+        for (const auto& record : bucket.records) {
+            if (record.visible) {
+                WriteQuad(&vertices[count], record, bucket.texture != nullptr);
+                count += 6;
+            }
+        }
+        if (count == 0) {
+            return;
+        }
+
+        vertices.resize(count);
+        target.draw(vertices, sf::RenderStates(bucket.texture));
+        draw_calls++;
+    }
+
+    size_t GetDrawCalls() const { return draw_calls; }
+
+private:
+    static void WriteQuad(sf::Vertex* quad, const DrawRecord& record, bool textured) {
+        // Textured quads are texture_rect sized like sf::Sprite, plain ones use size like sf::RectangleShape
+        sf::Vector2f extent = textured
+            ? sf::Vector2f(std::abs(static_cast<float>(record.texture_rect.width)),
+                           std::abs(static_cast<float>(record.texture_rect.height)))
+            : record.size;
+
+        float radians = record.rotation * 3.14159265f / 180.0f;
+        float cosine = std::cos(radians) * record.scale;
+        float sine = std::sin(radians) * record.scale;
+
+        auto corner = [&](float x, float y) {
+            x -= record.origin.x;
+            y -= record.origin.y;
+            return sf::Vector2f(record.position.x + x * cosine - y * sine,
+                                record.position.y + x * sine + y * cosine);
+        };
+
+        sf::Vector2f top_left = corner(0.0f, 0.0f);
+        sf::Vector2f top_right = corner(extent.x, 0.0f);
+        sf::Vector2f bottom_right = corner(extent.x, extent.y);
+        sf::Vector2f bottom_left = corner(0.0f, extent.y);
+
+        sf::Vector2f uv_top_left, uv_top_right, uv_bottom_right, uv_bottom_left;
+        if (textured) {
+            // Negative rect sizes flip, as with sf::Sprite
+            float left = static_cast<float>(record.texture_rect.left);
+            float top = static_cast<float>(record.texture_rect.top);
+            float right = left + static_cast<float>(record.texture_rect.width);
+            float bottom = top + static_cast<float>(record.texture_rect.height);
+            uv_top_left = {left, top};
+            uv_top_right = {right, top};
+            uv_bottom_right = {right, bottom};
+            uv_bottom_left = {left, bottom};
+        }
+
+        quad[0] = sf::Vertex(top_left, record.color, uv_top_left);
+        quad[1] = sf::Vertex(top_right, record.color, uv_top_right);
+        quad[2] = sf::Vertex(bottom_right, record.color, uv_bottom_right);
+        quad[3] = sf::Vertex(top_left, record.color, uv_top_left);
+        quad[4] = sf::Vertex(bottom_right, record.color, uv_bottom_right);
+        quad[5] = sf::Vertex(bottom_left, record.color, uv_bottom_left);
+    }
+
+    sf::VertexArray vertices;
+    size_t draw_calls{0};
+};
+
+} // namespace ecs
+
+#endif // ECS_SPRITE_BATCHER_H
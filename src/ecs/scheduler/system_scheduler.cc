@@ -0,0 +1,110 @@
+#include "system_scheduler.h"
+#include "util/i_threaded_workload.h"
+#include <algorithm>
+#include <chrono>
+
+namespace ecs {
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    float MillisecondsSince(Clock::time_point start) {
+        return std::chrono::duration<float, std::milli>(Clock::now() - start).count();
+    }
+}
+
+SystemScheduler::SystemDesc& SystemScheduler::Add(std::string name, SystemFn fn) {
+    auto& system = systems.emplace_back();
+    system.name = std::move(name);
+    system.fn = std::move(fn);
+    built = false;
+    warmed_up = false;
+    return system;
+}
+
+void SystemScheduler::Build() {
+    // Edges run from each system to every later system it conflicts with,
+    // a system's wave is the longest path to it so edges always cross waves
+    std::vector<size_t> level(systems.size(), 0);
+    size_t wave_count = 0;
+    for (size_t later = 0; later < systems.size(); ++later) {
+        for (size_t earlier = 0; earlier < later; ++earlier) {
+            if (Conflicts(systems[earlier], systems[later])) {
+                level[later] = std::max(level[later], level[earlier] + 1);
+            }
+        }
+        wave_count = std::max(wave_count, level[later] + 1);
+    }
+
+    waves.assign(wave_count, {});
+    timings.clear();
+    for (size_t index = 0; index < systems.size(); ++index) {
+        waves[level[index]].push_back(index);
+        timings.push_back({systems[index].name, level[index], 0.0f});
+    }
+    built = true;
+}
+
+void SystemScheduler::Run(float dt, IThreadedWorkload& workload) {
+    if (!built) {
+        Build();
+    }
+
+    auto start = Clock::now();
+
+    if (!warmed_up) {
+        for (size_t index = 0; index < systems.size(); ++index) {
+            RunSystem(index, dt);
+        }
+        warmed_up = true;
+    } else {
+        for (const auto& wave : waves) {
+            if (wave.size() == 1) {
+                RunSystem(wave.front(), dt);
+                continue;
+            }
+
+            for (auto index : wave) {
+                workload.AddTask([this, index, dt]() {
+                    RunSystem(index, dt);
+                });
+            }
+            workload.Join();
+        }
+    }
+
+    total_milliseconds = MillisecondsSince(start);
+}
+
+void SystemScheduler::Clear() {
+    systems.clear();
+    waves.clear();
+    timings.clear();
+    total_milliseconds = 0.0f;
+    built = false;
+    warmed_up = false;
+}
+
+bool SystemScheduler::Conflicts(const SystemDesc& a, const SystemDesc& b) {
+    if (a.exclusive || b.exclusive) {
+        return true;
+    }
+    return Intersects(a.writes, b.writes) ||
+           Intersects(a.writes, b.reads) ||
+           Intersects(a.reads, b.writes);
+}
+
+bool SystemScheduler::Intersects(const std::vector<entt::id_type>& a, const std::vector<entt::id_type>& b) {
+    return std::any_of(a.begin(), a.end(), [&b](entt::id_type id) {
+        return std::find(b.begin(), b.end(), id) != b.end();
+    });
+}
+
+void SystemScheduler::RunSystem(size_t index, float dt) {
+    // Each system owns its timing slot, so concurrent systems never share one
+    auto start = Clock::now();
+    systems[index].fn(dt);
+    timings[index].milliseconds = MillisecondsSince(start);
+}
+
+} // namespace ecs
@@ -0,0 +1,104 @@
+#ifndef ECS_SYSTEM_SCHEDULER_H
+#define ECS_SYSTEM_SCHEDULER_H
+
+#include <entt/entt.hpp>
+#include <functional>
+#include <string>
+#include <vector>
+#include <deque>
+#include <cstddef>
+
+class IThreadedWorkload;
+
+namespace ecs {
+
+/**
+ * SystemScheduler - Runs systems in parallel waves from declared access
+ * Each system declares the types it reads and writes, components or any
+ * other shared state (e.g. SpatialQuery). Two systems conflict when one
+ * writes something the other touches, a conflicting pair keeps its
+ * registration order and anything else may overlap. Build turns the
+ * declarations into a DAG once and levels it into waves, Run executes the
+ * waves in order with the systems of a wave spread across the workload.
+ *
+ * Exclusive systems conflict with everything and run alone on the calling
+ * thread. Use it for systems that create or destroy entities, add or remove
+ * components, fan out on the workload themselves, or touch state outside
+ * their declarations (input devices, game state callbacks). Structural
+ * changes queued on World's CommandBuffer are safe from any system.
+ *
+ * Results match running every system in registration order. The first Run
+ * does exactly that, so lazily created storages and groups exist before
+ * systems share the registry.
+ */
+class SystemScheduler {
+public:
+    using SystemFn = std::function<void(float)>;
+
+    struct SystemTiming {
+        std::string name;
+        size_t wave{0};
+        float milliseconds{0.0f};  // Last run
+    };
+
+    // Declared access of one system, filled in through the builder methods
+    class SystemDesc {
+    public:
+        template<typename... Types>
+        SystemDesc& Reads() {
+            (reads.push_back(entt::type_hash<Types>::value()), ...);
+            return *this;
+        }
+
+        template<typename... Types>
+        SystemDesc& Writes() {
+            (writes.push_back(entt::type_hash<Types>::value()), ...);
+            return *this;
+        }
+
+        SystemDesc& Exclusive() {
+            exclusive = true;
+            return *this;
+        }
+
+    private:
+        friend class SystemScheduler;
+
+        std::string name;
+        SystemFn fn;
+        std::vector<entt::id_type> reads;
+        std::vector<entt::id_type> writes;
+        bool exclusive{false};
+    };
+
+    // Register a system after the ones already added, declare its access on the result
+    SystemDesc& Add(std::string name, SystemFn fn);
+
+    // Build the dependency DAG and waves, Run builds on demand after systems change
+    void Build();
+
+    void Run(float dt, IThreadedWorkload& workload);
+
+    void Clear();
+
+    // Per system breakdown of the last Run, in registration order
+    const std::vector<SystemTiming>& GetTimings() const { return timings; }
+    float GetTotalMilliseconds() const { return total_milliseconds; }
+    size_t GetWaveCount() const { return waves.size(); }
+
+private:
+    static bool Conflicts(const SystemDesc& a, const SystemDesc& b);
+    static bool Intersects(const std::vector<entt::id_type>& a, const std::vector<entt::id_type>& b);
+    void RunSystem(size_t index, float dt);
+
+    std::deque<SystemDesc> systems;  // Deque keeps descriptions returned by Add valid
+    std::vector<std::vector<size_t>> waves;
+    std::vector<SystemTiming> timings;
+    float total_milliseconds{0.0f};
+    bool built{false};
+    bool warmed_up{false};
+};
+
+} // namespace ecs
+
+#endif // ECS_SYSTEM_SCHEDULER_H
@@ -0,0 +1,168 @@
+#ifndef ECS_CONTACT_CACHE_H
+#define ECS_CONTACT_CACHE_H
+
+#include <entt/entt.hpp>
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include <numeric>
+#include <utility>
+
+namespace ecs {
+
+enum class ContactEvent {
+    ENTER,  // First tick the pair touches
+    STAY,   // Still touching, duration keeps growing
+    EXIT    // Touched last tick but not this one (entities may be destroyed)
+};
+
+/**
+ * Contact - One touching entity pair
+ */
+struct Contact {
+    entt::entity entity_a{entt::null};
+    entt::entity entity_b{entt::null};
+    sf::Vector2f point{0.0f, 0.0f};  // Latest collision point
+    float duration{0.0f};  // Seconds since the contact began (0 on enter)
+};
+
+/**
+ * ContactCache - Frame coherent contacts keyed by entity pair
+ * Collisions found each tick are matched against last tick's contacts to
+ * report enter / stay / exit instead of a raw overlap every tick. Keys
+ * include the entity version, so a destroyed and recreated entity starts a
+ * fresh contact. Pooled entities keep their version across activations,
+ * their contacts are dropped with Forget when they go back to the pool.
+ *
+ * Enter and stay events fire in detection order, exits in key order.
+ */
+class ContactCache {
+public:
+    void Clear() {
+        contacts.clear();
+        current.clear();
+        matched.clear();
+        sorted.clear();
+        order.clear();
+        duplicate.clear();
+    }
+
+    // Start collecting this tick's collisions
+    void Begin() {
+        current.clear();
+        current.reserve(contacts.size());  // Last tick's contacts are the best size guess
+        matched.assign(contacts.size(), 0);
+    }
+
+    void Add(entt::entity a, entt::entity b, const sf::Vector2f& point) {
+        current.push_back({Key(a, b), {a, b, point, 0.0f}});
+    }
+
+    /**
+     * Match this tick's collisions against the cache and fire fn(event, contact)
+     * Must follow Begin, the cache is swapped to this tick's contacts afterwards
+     */
+    template<typename Fn>
+    void End(float dt, Fn&& fn) {
+        // The broad phase can report a pair more than once, only its first report counts
+        order.resize(current.size());
+        std::iota(order.begin(), order.end(), 0u);
+        std::sort(order.begin(), order.end(), [this](uint32_t a, uint32_t b) {
+            return current[a].first != current[b].first ? current[a].first < current[b].first : a < b;
+        });
+        duplicate.assign(current.size(), 0);
+        for (size_t i = 1; i < order.size(); ++i) {
+            if (current[order[i]].first == current[order[i - 1]].first) {
+                duplicate[order[i]] = 1;
+            }
+        }
+
+        for (size_t i = 0; i < current.size(); ++i) {
+            if (duplicate[i]) {
+                continue;
+            }
+
+            auto& [key, contact] = current[i];
+            auto found = Find(key);
+            if (found == contacts.end()) {
+                fn(ContactEvent::ENTER, contact);
+                continue;
+            }
+
+            matched[static_cast<size_t>(found - contacts.begin())] = 1;
+            contact.duration = found->second.duration + dt;
+            fn(ContactEvent::STAY, contact);
+        }
+
+        for (size_t i = 0; i < contacts.size(); ++i) {
+            if (!matched[i]) {
+                fn(ContactEvent::EXIT, contacts[i].second);
+            }
+        }
+
+        // This tick's contacts become the cache, sorted by key for lookup
+        sorted.clear();
+        for (auto i : order) {
+            if (!duplicate[i]) {
+                sorted.push_back(current[i]);
+            }
+        }
+        std::swap(contacts, sorted);
+    }
+
+    // Drop every contact involving one of entities (sorted), no exit is reported for them
+    void Forget(const std::vector<entt::entity>& entities) {
+        if (entities.empty()) {
+            return;
+        }
+
+        auto involved = [&](entt::entity entity) {
+            return std::binary_search(entities.begin(), entities.end(), entity);
+        };
+        contacts.erase(std::remove_if(contacts.begin(), contacts.end(), [&](const Entry& entry) {
+            return involved(entry.second.entity_a) || involved(entry.second.entity_b);
+        }), contacts.end());
+    }
+
+    // Contact between two entities from the last completed tick, nullptr if none
+    const Contact* Find(entt::entity a, entt::entity b) const {
+        auto found = Find(Key(a, b));
+        return found != contacts.end() ? &found->second : nullptr;
+    }
+
+    size_t GetContactCount() const { return contacts.size(); }
+
+private:
+    using Entry = std::pair<uint64_t, Contact>;
+
+    // Order independent pair key
+    static uint64_t Key(entt::entity a, entt::entity b) {
+        auto id_a = static_cast<uint64_t>(entt::to_integral(a));
+        auto id_b = static_cast<uint64_t>(entt::to_integral(b));
+        if (id_a > id_b) {
+            std::swap(id_a, id_b);
+        }
+        return (id_a << 32) | id_b;
+    }
+
+    std::vector<Entry>::const_iterator Find(uint64_t key) const {
+        auto found = std::lower_bound(contacts.begin(), contacts.end(), key, [](const Entry& entry, uint64_t value) {
+            return entry.first < value;
+        });
+        return found != contacts.end() && found->first == key ? found : contacts.end();
+    }
+
+    std::vector<Entry> contacts;  // Last tick, sorted by key
+    std::vector<Entry> current;   // This tick, detection order until End
+    std::vector<uint8_t> matched;
+
+    // End scratch, kept for their capacity
+    std::vector<Entry> sorted;
+    std::vector<uint32_t> order;  // Indices into current, sorted by key
+    std::vector<uint8_t> duplicate;
+};
+
+} // namespace ecs
+
+#endif // ECS_CONTACT_CACHE_H
@@ -0,0 +1,341 @@
+#ifndef ECS_NARROW_PHASE_BATCH_H
+#define ECS_NARROW_PHASE_BATCH_H
+
+#include <entt/entt.hpp>
+#include <SFML/Graphics.hpp>
+#include "spatial_hash_grid.h"
+#include "swept_test.h"
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include <cmath>
+
+#if defined(__AVX2__)
+#define ANNATAR_SIMD_AVX2 1
+#include <immintrin.h>
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define ANNATAR_SIMD_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace ecs {
+
+/**
+ * NarrowPhaseBatch - Batched narrow phase over candidate pairs
+ * Pairs from the broad phase are split by shape combination into
+ * structure-of-arrays batches, each batch is tested in one straight loop:
+ * circle-circle with SSE2 (4 wide) or AVX2 (8 wide) and a scalar tail,
+ * circle-rect and rect-rect as plain loops over the lanes.
+ * Tests are swept from each collider's start to end position over the tick,
+ * so fast colliders can't pass through each other between ticks.
+ * Hits are reported in the order the pairs were added.
+ *
+ * Lanes stay in the order pairs were added, not sorted by entity. Each lane
+ * holds copies of the shape data and is read front to back, so the entity
+ * order doesn't change what the tests touch. Sorting cost more than the
+ * whole Execute.
+ */
+class NarrowPhaseBatch {
+public:
+    struct Hit {
+        uint32_t sequence;
+        entt::entity entity_a;
+        entt::entity entity_b;
+        sf::Vector2f point;  // Midpoint of the two centres at the time of impact
+        float time;          // Time of impact as a fraction of the tick
+    };
+
+    void Clear() {
+        circle_circle.Clear();
+        circle_rect.Clear();
+        rect_rect.Clear();
+        hits.clear();
+        segment_ends.clear();
+        sequence = 0;
+    }
+
+    // Queue a candidate pair, a/b order is kept for the reported hit
+    void Add(const SpatialProxy& a, const SpatialProxy& b) {
+        bool circle_a = a.shape == Collision::Shape::CIRCLE;
+        bool circle_b = b.shape == Collision::Shape::CIRCLE;
+
+        if (circle_a && circle_b) {
+            circle_circle.Push(sequence, a, b);
+        } else if (!circle_a && !circle_b) {
+            rect_rect.Push(sequence, a, b);
+        } else if (circle_a) {
+            circle_rect.Push(sequence, a, b);
+        } else {
+            // Circle always goes in the a lanes, entities stay in pair order
+            circle_rect.Push(sequence, b, a);
+            std::swap(circle_rect.entity_a.back(), circle_rect.entity_b.back());
+        }
+        ++sequence;
+    }
+
+    // Close the current segment, pairs added so far sort before later segments
+    void EndSegment() {
+        segment_ends.push_back(sequence);
+    }
+
+    // Test every queued pair and collect hits in pair order
+    void Execute() {
+        TestCircleCircle(circle_circle);
+        TestCircleRect(circle_rect);
+        TestRectRect(rect_rect);
+
+        hits.clear();
+        Collect(circle_circle);
+        Collect(circle_rect);
+        Collect(rect_rect);
+
+        std::sort(hits.begin(), hits.end(), [](const Hit& a, const Hit& b) {
+            return a.sequence < b.sequence;
+        });
+    }
+
+    const std::vector<Hit>& GetHits() const { return hits; }
+    size_t GetPairCount() const { return sequence; }
+    const std::vector<uint32_t>& GetSegmentEnds() const { return segment_ends; }
+
+private:
+    /**
+     * PairLanes - One SoA batch
+     * Circles use extent_x as radius, rectangles store half extents
+     */
+    struct PairLanes {
+        std::vector<float> ax, ay, a_start_x, a_start_y, a_extent_x, a_extent_y;
+        std::vector<float> bx, by, b_start_x, b_start_y, b_extent_x, b_extent_y;
+        std::vector<uint32_t> a_layer, a_mask, b_layer, b_mask;
+        std::vector<uint32_t> sequence;
+        std::vector<entt::entity> entity_a, entity_b;
+        std::vector<uint8_t> hit;
+        std::vector<float> time;
+
+        size_t Size() const { return sequence.size(); }
+
+        void Clear() {
+            ax.clear(); ay.clear(); a_start_x.clear(); a_start_y.clear(); a_extent_x.clear(); a_extent_y.clear();
+            bx.clear(); by.clear(); b_start_x.clear(); b_start_y.clear(); b_extent_x.clear(); b_extent_y.clear();
+            a_layer.clear(); a_mask.clear(); b_layer.clear(); b_mask.clear();
+            sequence.clear();
+            entity_a.clear(); entity_b.clear();
+            hit.clear();
+            time.clear();
+        }
+
+        void Push(uint32_t seq, const SpatialProxy& a, const SpatialProxy& b) {
+            PushSide(a, ax, ay, a_start_x, a_start_y, a_extent_x, a_extent_y, a_layer, a_mask);
+            PushSide(b, bx, by, b_start_x, b_start_y, b_extent_x, b_extent_y, b_layer, b_mask);
+            sequence.push_back(seq);
+            entity_a.push_back(a.entity);
+            entity_b.push_back(b.entity);
+        }
+
+        static void PushSide(const SpatialProxy& proxy,
+                             std::vector<float>& x, std::vector<float>& y,
+                             std::vector<float>& start_x, std::vector<float>& start_y,
+                             std::vector<float>& extent_x, std::vector<float>& extent_y,
+                             std::vector<uint32_t>& layer, std::vector<uint32_t>& mask) {
+            x.push_back(proxy.position.x);
+            y.push_back(proxy.position.y);
+            start_x.push_back(proxy.start.x);
+            start_y.push_back(proxy.start.y);
+            extent_x.push_back(proxy.extent.x);
+            extent_y.push_back(proxy.extent.y);
+            layer.push_back(proxy.layer);
+            mask.push_back(proxy.mask);
+        }
+    };
+
+    // Either side's layer is in the other's mask
+    static uint8_t LayersInteract(const PairLanes& lanes, size_t i) {
+        return ((lanes.a_layer[i] & lanes.b_mask[i]) | (lanes.b_layer[i] & lanes.a_mask[i])) != 0;
+    }
+
+    // b's start relative to a, and b's motion relative to a over the tick
+    static sf::Vector2f RelativeStart(const PairLanes& lanes, size_t i) {
+        return sf::Vector2f(lanes.b_start_x[i] - lanes.a_start_x[i], lanes.b_start_y[i] - lanes.a_start_y[i]);
+    }
+
+    static sf::Vector2f RelativeMotion(const PairLanes& lanes, size_t i) {
+        return sf::Vector2f((lanes.bx[i] - lanes.b_start_x[i]) - (lanes.ax[i] - lanes.a_start_x[i]),
+                            (lanes.by[i] - lanes.b_start_y[i]) - (lanes.ay[i] - lanes.a_start_y[i]));
+    }
+
+    /**
+     * Circle-circle hit test by closest approach of the relative motion:
+     * t = clamp(-(p.d) / (d.d), 0, 1), hit when |p + d t| <= r_a + r_b.
+     * Time of impact is only solved for the lanes that hit.
+     */
+    static void TestCircleCircle(PairLanes& lanes) {
+        const size_t count = lanes.Size();
+        lanes.hit.resize(count);
+        lanes.time.resize(count);
+        size_t i = 0;
+
+#if defined(ANNATAR_SIMD_AVX2)
+        const __m256i zero8 = _mm256_setzero_si256();
+        const __m256 zero8f = _mm256_setzero_ps();
+        const __m256 one8f = _mm256_set1_ps(1.0f);
+        const __m256 epsilon8 = _mm256_set1_ps(1e-12f);
+        for (; i + 8 <= count; i += 8) {
+            __m256 a_start_x = _mm256_loadu_ps(&lanes.a_start_x[i]);
+            __m256 a_start_y = _mm256_loadu_ps(&lanes.a_start_y[i]);
+            __m256 b_start_x = _mm256_loadu_ps(&lanes.b_start_x[i]);
+            __m256 b_start_y = _mm256_loadu_ps(&lanes.b_start_y[i]);
+            __m256 px = _mm256_sub_ps(b_start_x, a_start_x);
+            __m256 py = _mm256_sub_ps(b_start_y, a_start_y);
+            __m256 dx = _mm256_sub_ps(_mm256_sub_ps(_mm256_loadu_ps(&lanes.bx[i]), b_start_x),
+                                      _mm256_sub_ps(_mm256_loadu_ps(&lanes.ax[i]), a_start_x));
+            __m256 dy = _mm256_sub_ps(_mm256_sub_ps(_mm256_loadu_ps(&lanes.by[i]), b_start_y),
+                                      _mm256_sub_ps(_mm256_loadu_ps(&lanes.ay[i]), a_start_y));
+
+            __m256 pd = _mm256_add_ps(_mm256_mul_ps(px, dx), _mm256_mul_ps(py, dy));
+            __m256 dd = _mm256_max_ps(_mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy)), epsilon8);
+            __m256 t = _mm256_min_ps(_mm256_max_ps(_mm256_div_ps(_mm256_sub_ps(zero8f, pd), dd), zero8f), one8f);
+            __m256 cx = _mm256_add_ps(px, _mm256_mul_ps(dx, t));
+            __m256 cy = _mm256_add_ps(py, _mm256_mul_ps(dy, t));
+
+            __m256 radius_sum = _mm256_add_ps(_mm256_loadu_ps(&lanes.a_extent_x[i]), _mm256_loadu_ps(&lanes.b_extent_x[i]));
+            __m256 distance_sq = _mm256_add_ps(_mm256_mul_ps(cx, cx), _mm256_mul_ps(cy, cy));
+            __m256 overlap = _mm256_cmp_ps(distance_sq, _mm256_mul_ps(radius_sum, radius_sum), _CMP_LE_OQ);
+
+            __m256i layers = _mm256_or_si256(
+                _mm256_and_si256(LoadU256(&lanes.a_layer[i]), LoadU256(&lanes.b_mask[i])),
+                _mm256_and_si256(LoadU256(&lanes.b_layer[i]), LoadU256(&lanes.a_mask[i])));
+            __m256 blocked = _mm256_castsi256_ps(_mm256_cmpeq_epi32(layers, zero8));
+
+            int bits = _mm256_movemask_ps(_mm256_andnot_ps(blocked, overlap));
+            for (int lane = 0; lane < 8; ++lane) {
+                lanes.hit[i + lane] = static_cast<uint8_t>((bits >> lane) & 1);
+            }
+        }
+#endif
+
+#if defined(ANNATAR_SIMD_SSE2)
+        const __m128i zero4 = _mm_setzero_si128();
+        const __m128 zero4f = _mm_setzero_ps();
+        const __m128 one4f = _mm_set1_ps(1.0f);
+        const __m128 epsilon4 = _mm_set1_ps(1e-12f);
+        for (; i + 4 <= count; i += 4) {
+            __m128 a_start_x = _mm_loadu_ps(&lanes.a_start_x[i]);
+            __m128 a_start_y = _mm_loadu_ps(&lanes.a_start_y[i]);
+            __m128 b_start_x = _mm_loadu_ps(&lanes.b_start_x[i]);
+            __m128 b_start_y = _mm_loadu_ps(&lanes.b_start_y[i]);
+            __m128 px = _mm_sub_ps(b_start_x, a_start_x);
+            __m128 py = _mm_sub_ps(b_start_y, a_start_y);
+            __m128 dx = _mm_sub_ps(_mm_sub_ps(_mm_loadu_ps(&lanes.bx[i]), b_start_x),
+                                   _mm_sub_ps(_mm_loadu_ps(&lanes.ax[i]), a_start_x));
+            __m128 dy = _mm_sub_ps(_mm_sub_ps(_mm_loadu_ps(&lanes.by[i]), b_start_y),
+                                   _mm_sub_ps(_mm_loadu_ps(&lanes.ay[i]), a_start_y));
+
+            __m128 pd = _mm_add_ps(_mm_mul_ps(px, dx), _mm_mul_ps(py, dy));
+            __m128 dd = _mm_max_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), epsilon4);
+            __m128 t = _mm_min_ps(_mm_max_ps(_mm_div_ps(_mm_sub_ps(zero4f, pd), dd), zero4f), one4f);
+            __m128 cx = _mm_add_ps(px, _mm_mul_ps(dx, t));
+            __m128 cy = _mm_add_ps(py, _mm_mul_ps(dy, t));
+
+            __m128 radius_sum = _mm_add_ps(_mm_loadu_ps(&lanes.a_extent_x[i]), _mm_loadu_ps(&lanes.b_extent_x[i]));
+            __m128 distance_sq = _mm_add_ps(_mm_mul_ps(cx, cx), _mm_mul_ps(cy, cy));
+            __m128 overlap = _mm_cmple_ps(distance_sq, _mm_mul_ps(radius_sum, radius_sum));
+
+            __m128i layers = _mm_or_si128(
+                _mm_and_si128(LoadU128(&lanes.a_layer[i]), LoadU128(&lanes.b_mask[i])),
+                _mm_and_si128(LoadU128(&lanes.b_layer[i]), LoadU128(&lanes.a_mask[i])));
+            __m128 blocked = _mm_castsi128_ps(_mm_cmpeq_epi32(layers, zero4));
+
+            int bits = _mm_movemask_ps(_mm_andnot_ps(blocked, overlap));
+            for (int lane = 0; lane < 4; ++lane) {
+                lanes.hit[i + lane] = static_cast<uint8_t>((bits >> lane) & 1);
+            }
+        }
+#endif
+
+        // Scalar tail (or everything without SIMD)
+        for (; i < count; ++i) {
+            sf::Vector2f start = RelativeStart(lanes, i);
+            sf::Vector2f motion = RelativeMotion(lanes, i);
+            float pd = start.x * motion.x + start.y * motion.y;
+            float dd = std::max(motion.x * motion.x + motion.y * motion.y, 1e-12f);
+            float t = std::clamp(-pd / dd, 0.0f, 1.0f);
+            sf::Vector2f closest = start + motion * t;
+            float radius_sum = lanes.a_extent_x[i] + lanes.b_extent_x[i];
+            uint8_t overlap = (closest.x * closest.x + closest.y * closest.y) <= (radius_sum * radius_sum);
+            lanes.hit[i] = overlap & LayersInteract(lanes, i);
+        }
+
+        for (i = 0; i < count; ++i) {
+            if (lanes.hit[i]) {
+                float radius_sum = lanes.a_extent_x[i] + lanes.b_extent_x[i];
+                lanes.time[i] = SweptTest::Circle(RelativeStart(lanes, i), RelativeMotion(lanes, i), radius_sum).value_or(1.0f);
+            }
+        }
+    }
+
+    // a lanes hold the circle, b lanes the rectangle
+    static void TestCircleRect(PairLanes& lanes) {
+        const size_t count = lanes.Size();
+        lanes.hit.resize(count);
+        lanes.time.resize(count);
+        for (size_t i = 0; i < count; ++i) {
+            // Circle relative to the rectangle
+            sf::Vector2f half_extents(lanes.b_extent_x[i], lanes.b_extent_y[i]);
+            auto time = SweptTest::RoundedBox(-RelativeStart(lanes, i), -RelativeMotion(lanes, i), half_extents, lanes.a_extent_x[i]);
+            lanes.hit[i] = time.has_value() & LayersInteract(lanes, i);
+            lanes.time[i] = time.value_or(1.0f);
+        }
+    }
+
+    static void TestRectRect(PairLanes& lanes) {
+        const size_t count = lanes.Size();
+        lanes.hit.resize(count);
+        lanes.time.resize(count);
+        for (size_t i = 0; i < count; ++i) {
+            sf::Vector2f half_extents(lanes.a_extent_x[i] + lanes.b_extent_x[i], lanes.a_extent_y[i] + lanes.b_extent_y[i]);
+            auto time = SweptTest::Box(RelativeStart(lanes, i), RelativeMotion(lanes, i), half_extents);
+            lanes.hit[i] = time.has_value() & LayersInteract(lanes, i);
+            lanes.time[i] = time.value_or(1.0f);
+        }
+    }
+
+    void Collect(const PairLanes& lanes) {
+        for (size_t i = 0; i < lanes.Size(); ++i) {
+            if (!lanes.hit[i]) {
+                continue;
+            }
+            // Midpoint of the two collider centres at the time of impact
+            float t = lanes.time[i];
+            sf::Vector2f a(lanes.a_start_x[i] + (lanes.ax[i] - lanes.a_start_x[i]) * t,
+                           lanes.a_start_y[i] + (lanes.ay[i] - lanes.a_start_y[i]) * t);
+            sf::Vector2f b(lanes.b_start_x[i] + (lanes.bx[i] - lanes.b_start_x[i]) * t,
+                           lanes.b_start_y[i] + (lanes.by[i] - lanes.b_start_y[i]) * t);
+            hits.push_back({lanes.sequence[i], lanes.entity_a[i], lanes.entity_b[i], (a + b) * 0.5f, t});
+        }
+    }
+
+#if defined(ANNATAR_SIMD_AVX2)
+    static __m256i LoadU256(const uint32_t* data) {
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+    }
+#endif
+
+#if defined(ANNATAR_SIMD_SSE2)
+    static __m128i LoadU128(const uint32_t* data) {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+    }
+#endif
+
+    PairLanes circle_circle;
+    PairLanes circle_rect;
+    PairLanes rect_rect;
+    std::vector<Hit> hits;
+    std::vector<uint32_t> segment_ends;  // Sequence after each EndSegment
+    uint32_t sequence{0};
+};
+
+} // namespace ecs
+
+#endif // ECS_NARROW_PHASE_BATCH_H
@@ -0,0 +1,471 @@
+#ifndef ECS_SPATIAL_HASH_GRID_H
+#define ECS_SPATIAL_HASH_GRID_H
+
+#include <entt/entt.hpp>
+#include <SFML/Graphics.hpp>
+#include "../components/components.h"
+#include "swept_test.h"
+#include <vector>
+#include <array>
+#include <utility>
+#include <cstdint>
+#include <cmath>
+#include <algorithm>
+#include <bit>
+#include <limits>
+#include <optional>
+
+namespace ecs {
+
+/**
+ * SpatialProxy - Broad phase record for one collider
+ * Shape data is copied so proxies stay usable after the registry changes
+ */
+struct SpatialProxy {
+    entt::entity entity{entt::null};
+    sf::Vector2f position{0.0f, 0.0f};  // Collider centre (transform position + offset)
+    sf::Vector2f start{0.0f, 0.0f};     // Collider centre at the start of the tick
+    sf::Vector2f min{0.0f, 0.0f};       // AABB (covers the swept path)
+    sf::Vector2f max{0.0f, 0.0f};
+    uint32_t layer{0};
+    uint32_t mask{0xFFFFFFFF};
+    Collision::Shape shape{Collision::Shape::CIRCLE};
+    sf::Vector2f extent{0.0f, 0.0f};    // Radius (x and y) for circles, half size for rectangles
+
+    // Layer bucket (lowest set layer bit), assigned on insert
+    uint32_t bucket{0};
+
+    // Covered cell range (inclusive)
+    int32_t cell_min_x{0};
+    int32_t cell_min_y{0};
+    int32_t cell_max_x{0};
+    int32_t cell_max_y{0};
+};
+
+/**
+ * SpatialHashGrid - Uniform grid broad phase
+ * Every proxy is registered in each cell its AABB overlaps, cell entries are
+ * sorted by layer bucket then cell key so occupied cells are contiguous runs.
+ * A pair sharing several cells is only reported from the first cell both
+ * proxies cover.
+ *
+ * Proxies are bucketed by their lowest layer bit. When a layer matrix is set
+ * only the enabled bucket pairs are walked, so layers that never interact
+ * (e.g. player bullets vs player bullets) cost nothing.
+ *
+ * Pair walks can be limited to a range of cell keys. A pair is owned by the
+ * range holding its first shared cell, so disjoint ranges report disjoint
+ * pairs and can be walked from different threads.
+ *
+ * Ray casts step through the cells under the ray (grid DDA) and only test
+ * proxies registered in those cells, against their end of tick shape.
+ */
+class SpatialHashGrid {
+public:
+    // One bucket per layer bit plus one for colliders without a layer
+    static constexpr uint32_t kLayerBucketCount = 33;
+    static constexpr uint32_t kUnlayeredBucket = 32;
+
+    struct RaycastHit {
+        entt::entity entity{entt::null};
+        sf::Vector2f point{0.0f, 0.0f};
+        float distance{0.0f};  // Along the ray from its origin
+    };
+
+    // Inclusive range of cell keys
+    struct CellRange {
+        uint64_t first{0};
+        uint64_t last{std::numeric_limits<uint64_t>::max()};
+    };
+
+    explicit SpatialHashGrid(float cell_size = 64.0f) {
+        SetCellSize(cell_size);
+        SetLayerPairs({});
+    }
+
+    void SetCellSize(float size) {
+        cell_size = size > 1.0f ? size : 1.0f;
+        inv_cell_size = 1.0f / cell_size;
+    }
+
+    float GetCellSize() const { return cell_size; }
+
+    /**
+     * Restrict pairing to the given layer pairs (layer bit flags)
+     * An empty list pairs every bucket with every other bucket
+     */
+    void SetLayerPairs(const std::vector<std::pair<uint32_t, uint32_t>>& pairs) {
+        bucket_pairs.clear();
+        for (const auto& [layer_a, layer_b] : pairs) {
+            auto bucket_a = LayerBucket(layer_a);
+            auto bucket_b = LayerBucket(layer_b);
+            if (bucket_a > bucket_b) {
+                std::swap(bucket_a, bucket_b);
+            }
+            if (std::find(bucket_pairs.begin(), bucket_pairs.end(),
+                          std::make_pair(bucket_a, bucket_b)) == bucket_pairs.end()) {
+                bucket_pairs.emplace_back(bucket_a, bucket_b);
+            }
+        }
+
+        if (bucket_pairs.empty()) {
+            for (uint32_t bucket_a = 0; bucket_a < kLayerBucketCount; ++bucket_a) {
+                for (uint32_t bucket_b = bucket_a; bucket_b < kLayerBucketCount; ++bucket_b) {
+                    bucket_pairs.emplace_back(bucket_a, bucket_b);
+                }
+            }
+        }
+    }
+
+    // Bucket pairs are walked in this order, index with ForEachCandidatePair
+    size_t GetBucketPairCount() const { return bucket_pairs.size(); }
+
+    static uint32_t LayerBucket(uint32_t layer) {
+        return layer == 0 ? kUnlayeredBucket : static_cast<uint32_t>(std::countr_zero(layer));
+    }
+
+    // Drop all proxies, keeps capacity so rebuilding each tick doesn't allocate
+    void Clear() {
+        proxies.clear();
+        cells.clear();
+        bucket_begin.fill(0);
+    }
+
+    void Reserve(size_t count) {
+        proxies.reserve(count);
+        cells.reserve(count * 2);
+    }
+
+    // Add a proxy, returns its index (proxies are indexed in insertion order)
+    uint32_t Insert(const SpatialProxy& proxy) {
+        auto index = static_cast<uint32_t>(proxies.size());
+        auto& stored = proxies.emplace_back(proxy);
+
+        stored.bucket = LayerBucket(stored.layer);
+        stored.cell_min_x = CellCoord(stored.min.x);
+        stored.cell_min_y = CellCoord(stored.min.y);
+        stored.cell_max_x = CellCoord(stored.max.x);
+        stored.cell_max_y = CellCoord(stored.max.y);
+
+        for (int32_t cy = stored.cell_min_y; cy <= stored.cell_max_y; ++cy) {
+            for (int32_t cx = stored.cell_min_x; cx <= stored.cell_max_x; ++cx) {
+                cells.push_back({CellKey(cx, cy), index, stored.bucket});
+            }
+        }
+        return index;
+    }
+
+    // Sort cell entries, call once after all proxies are inserted
+    void Build() {
+        std::sort(cells.begin(), cells.end(), [](const CellEntry& a, const CellEntry& b) {
+            if (a.bucket != b.bucket) return a.bucket < b.bucket;
+            return a.key != b.key ? a.key < b.key : a.proxy < b.proxy;
+        });
+
+        // Bucket offsets into the sorted cell entries
+        size_t entry = 0;
+        for (uint32_t bucket = 0; bucket < kLayerBucketCount; ++bucket) {
+            bucket_begin[bucket] = entry;
+            while (entry < cells.size() && cells[entry].bucket == bucket) {
+                ++entry;
+            }
+        }
+        bucket_begin[kLayerBucketCount] = entry;
+    }
+
+    /**
+     * Invoke fn(a, b) once for every pair of proxies with overlapping AABBs
+     * that share a cell and whose layers are paired. a is always the proxy
+     * inserted first.
+     */
+    template<typename Fn>
+    void ForEachCandidatePair(Fn&& fn) const {
+        for (size_t bucket_pair = 0; bucket_pair < bucket_pairs.size(); ++bucket_pair) {
+            ForEachCandidatePair(bucket_pair, CellRange{}, fn);
+        }
+    }
+
+    // Pairs of one bucket pair whose first shared cell lies in range
+    template<typename Fn>
+    void ForEachCandidatePair(size_t bucket_pair, const CellRange& range, Fn&& fn) const {
+        const auto& [bucket_a, bucket_b] = bucket_pairs[bucket_pair];
+        VisitBucketPair(bucket_a, bucket_b, range, fn);
+    }
+
+    /**
+     * Split the occupied cells into at most count key ranges holding a
+     * similar number of cell entries, ranges are in ascending key order
+     * and together cover every key. Call after Build.
+     *
+     * Entries are only sorted per layer bucket, so the key quantiles are
+     * selected with nth_element (linear per split) instead of a full sort.
+     */
+    const std::vector<CellRange>& PartitionCells(size_t count) {
+        partition_keys.clear();
+        for (const auto& cell : cells) {
+            partition_keys.push_back(cell.key);
+        }
+
+        // Ranges start at entry quantiles, repeated keys don't open empty ranges
+        // Each selection leaves larger keys after it, so the next one only scans the tail
+        partitions.clear();
+        partitions.push_back({});
+        auto selected = partition_keys.begin();
+        for (size_t part = 1; part < count && !partition_keys.empty(); ++part) {
+            auto nth = partition_keys.begin() + static_cast<std::ptrdiff_t>(partition_keys.size() * part / count);
+            std::nth_element(selected, nth, partition_keys.end());
+            selected = nth;
+
+            uint64_t key = *nth;
+            if (key > partitions.back().first) {
+                partitions.back().last = key - 1;
+                partitions.push_back({key, std::numeric_limits<uint64_t>::max()});
+            }
+        }
+        return partitions;
+    }
+
+    /**
+     * Closest proxy on layer_mask hit by the segment origin + direction * [0, max_distance]
+     * direction must be normalised, an origin inside a collider hits it at distance 0
+     */
+    std::optional<RaycastHit> RaycastFirst(const sf::Vector2f& origin, const sf::Vector2f& direction,
+                                           float max_distance, uint32_t layer_mask) const {
+        std::optional<RaycastHit> closest;
+        TraverseCells(origin, direction, max_distance, [&](uint64_t key, float cell_exit) {
+            ForEachProxyInCell(key, layer_mask, [&](const SpatialProxy& proxy) {
+                auto hit = RaycastProxy(origin, direction, max_distance, proxy);
+                if (hit && (!closest || hit->distance < closest->distance)) {
+                    closest = hit;
+                }
+            });
+
+            // Any hit before the end of this cell can't be beaten further along
+            return !closest || closest->distance > cell_exit;
+        });
+        return closest;
+    }
+
+    // Every proxy on layer_mask hit by the segment, appended to hits nearest first
+    void RaycastAll(const sf::Vector2f& origin, const sf::Vector2f& direction,
+                    float max_distance, uint32_t layer_mask, std::vector<RaycastHit>& hits) const {
+        auto first = hits.size();
+        TraverseCells(origin, direction, max_distance, [&](uint64_t key, float) {
+            ForEachProxyInCell(key, layer_mask, [&](const SpatialProxy& proxy) {
+                if (auto hit = RaycastProxy(origin, direction, max_distance, proxy)) {
+                    hits.push_back(*hit);
+                }
+            });
+            return true;
+        });
+
+        // Proxies covering several cells are found once per cell
+        auto begin = hits.begin() + first;
+        std::sort(begin, hits.end(), [](const RaycastHit& a, const RaycastHit& b) {
+            if (a.distance != b.distance) return a.distance < b.distance;
+            return entt::to_integral(a.entity) < entt::to_integral(b.entity);
+        });
+        hits.erase(std::unique(begin, hits.end(), [](const RaycastHit& a, const RaycastHit& b) {
+            return a.entity == b.entity;
+        }), hits.end());
+    }
+
+    const std::vector<SpatialProxy>& GetProxies() const { return proxies; }
+    size_t GetProxyCount() const { return proxies.size(); }
+
+    static bool Overlaps(const SpatialProxy& a, const SpatialProxy& b) {
+        return !(a.max.x < b.min.x || b.max.x < a.min.x ||
+                 a.max.y < b.min.y || b.max.y < a.min.y);
+    }
+
+private:
+    struct CellEntry {
+        uint64_t key;
+        uint32_t proxy;
+        uint32_t bucket;
+    };
+
+    // End of the run of entries sharing cells[begin].key
+    size_t RunEnd(size_t begin, size_t end) const {
+        size_t run_end = begin + 1;
+        while (run_end < end && cells[run_end].key == cells[begin].key) {
+            ++run_end;
+        }
+        return run_end;
+    }
+
+    template<typename Fn>
+    void EmitIfFirstSharedCell(uint32_t index_a, uint32_t index_b, uint64_t key, Fn& fn) const {
+        if (index_a > index_b) {
+            std::swap(index_a, index_b);
+        }
+        const auto& a = proxies[index_a];
+        const auto& b = proxies[index_b];
+
+        // Only the first shared cell reports the pair
+        auto cx = static_cast<int32_t>(key >> 32);
+        auto cy = static_cast<int32_t>(key & 0xFFFFFFFFu);
+        if (std::max(a.cell_min_x, b.cell_min_x) != cx ||
+            std::max(a.cell_min_y, b.cell_min_y) != cy) {
+            return;
+        }
+
+        if (!Overlaps(a, b)) {
+            return;
+        }
+
+        fn(a, b);
+    }
+
+    // Entries of one bucket with keys in range, as [begin, end) indices
+    std::pair<size_t, size_t> BucketRange(uint32_t bucket, const CellRange& range) const {
+        auto begin = cells.begin() + bucket_begin[bucket];
+        auto end = cells.begin() + bucket_begin[bucket + 1];
+        auto first = std::lower_bound(begin, end, range.first, [](const CellEntry& cell, uint64_t key) {
+            return cell.key < key;
+        });
+        auto last = std::upper_bound(first, end, range.last, [](uint64_t key, const CellEntry& cell) {
+            return key < cell.key;
+        });
+        return {static_cast<size_t>(first - cells.begin()), static_cast<size_t>(last - cells.begin())};
+    }
+
+    template<typename Fn>
+    void VisitBucketPair(uint32_t bucket_a, uint32_t bucket_b, const CellRange& range, Fn& fn) const {
+        auto [a, a_end] = BucketRange(bucket_a, range);
+
+        if (bucket_a == bucket_b) {
+            // Same layer - pairs within each cell run
+            while (a < a_end) {
+                size_t run_end = RunEnd(a, a_end);
+                for (size_t i = a; i < run_end; ++i) {
+                    for (size_t j = i + 1; j < run_end; ++j) {
+                        EmitIfFirstSharedCell(cells[i].proxy, cells[j].proxy, cells[a].key, fn);
+                    }
+                }
+                a = run_end;
+            }
+            return;
+        }
+
+        // Different layers - merge join the two sorted cell lists
+        auto [b, b_end] = BucketRange(bucket_b, range);
+
+        while (a < a_end && b < b_end) {
+            if (cells[a].key < cells[b].key) {
+                a = RunEnd(a, a_end);
+            } else if (cells[b].key < cells[a].key) {
+                b = RunEnd(b, b_end);
+            } else {
+                size_t run_a_end = RunEnd(a, a_end);
+                size_t run_b_end = RunEnd(b, b_end);
+                for (size_t i = a; i < run_a_end; ++i) {
+                    for (size_t j = b; j < run_b_end; ++j) {
+                        EmitIfFirstSharedCell(cells[i].proxy, cells[j].proxy, cells[a].key, fn);
+                    }
+                }
+                a = run_a_end;
+                b = run_b_end;
+            }
+        }
+    }
+
+    /**
+     * Visit the cells under a segment in order (Amanatides & Woo)
+     * fn(key, cell_exit) gets the distance at which the ray leaves the cell
+     * and returns false to stop.
+     */
+    template<typename Fn>
+    void TraverseCells(const sf::Vector2f& origin, const sf::Vector2f& direction, float max_distance, Fn&& fn) const {
+        constexpr float kNever = std::numeric_limits<float>::infinity();
+
+        int32_t cx = CellCoord(origin.x);
+        int32_t cy = CellCoord(origin.y);
+        int32_t step_x = direction.x > 0.0f ? 1 : (direction.x < 0.0f ? -1 : 0);
+        int32_t step_y = direction.y > 0.0f ? 1 : (direction.y < 0.0f ? -1 : 0);
+
+        // Distance to the first boundary crossed on each axis, and between boundaries
+        float next_x = step_x != 0 ? ((cx + (step_x > 0 ? 1 : 0)) * cell_size - origin.x) / direction.x : kNever;
+        float next_y = step_y != 0 ? ((cy + (step_y > 0 ? 1 : 0)) * cell_size - origin.y) / direction.y : kNever;
+        float delta_x = step_x != 0 ? cell_size / std::abs(direction.x) : kNever;
+        float delta_y = step_y != 0 ? cell_size / std::abs(direction.y) : kNever;
+
+        while (true) {
+            float cell_exit = std::min({next_x, next_y, max_distance});
+            if (!fn(CellKey(cx, cy), cell_exit) || cell_exit >= max_distance) {
+                return;
+            }
+
+            if (next_x < next_y) {
+                cx += step_x;
+                next_x += delta_x;
+            } else {
+                cy += step_y;
+                next_y += delta_y;
+            }
+        }
+    }
+
+    // Proxies registered in one cell whose layer is in layer_mask
+    template<typename Fn>
+    void ForEachProxyInCell(uint64_t key, uint32_t layer_mask, Fn&& fn) const {
+        if (layer_mask == 0) {
+            return;
+        }
+
+        // A proxy sits in the bucket of its lowest layer bit, so only buckets
+        // up to the highest mask bit can hold a matching layer
+        auto last_bucket = static_cast<uint32_t>(31 - std::countl_zero(layer_mask));
+        for (uint32_t bucket = 0; bucket <= last_bucket; ++bucket) {
+            auto [entry, end] = BucketRange(bucket, CellRange{key, key});
+            for (; entry < end; ++entry) {
+                const auto& proxy = proxies[cells[entry].proxy];
+                if (proxy.layer & layer_mask) {
+                    fn(proxy);
+                }
+            }
+        }
+    }
+
+    static std::optional<RaycastHit> RaycastProxy(const sf::Vector2f& origin, const sf::Vector2f& direction,
+                                                  float max_distance, const SpatialProxy& proxy) {
+        sf::Vector2f start = origin - proxy.position;
+        sf::Vector2f motion = direction * max_distance;
+        auto time = proxy.shape == Collision::Shape::CIRCLE
+            ? SweptTest::Circle(start, motion, proxy.extent.x)
+            : SweptTest::Box(start, motion, proxy.extent);
+        if (!time) {
+            return std::nullopt;
+        }
+
+        float distance = *time * max_distance;
+        return RaycastHit{proxy.entity, origin + direction * distance, distance};
+    }
+
+    int32_t CellCoord(float value) const {
+        return static_cast<int32_t>(std::floor(value * inv_cell_size));
+    }
+
+    static uint64_t CellKey(int32_t cx, int32_t cy) {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(cx)) << 32) |
+               static_cast<uint64_t>(static_cast<uint32_t>(cy));
+    }
+
+    float cell_size{64.0f};
+    float inv_cell_size{1.0f / 64.0f};
+
+    std::vector<SpatialProxy> proxies;
+    std::vector<CellEntry> cells;
+    std::array<size_t, kLayerBucketCount + 1> bucket_begin{};
+
+    // Enabled bucket pairs (bucket_a <= bucket_b), every pair when no matrix is set
+    std::vector<std::pair<uint32_t, uint32_t>> bucket_pairs;
+
+    // PartitionCells scratch
+    std::vector<uint64_t> partition_keys;
+    std::vector<CellRange> partitions;
+};
+
+} // namespace ecs
+
+#endif // ECS_SPATIAL_HASH_GRID_H
@@ -0,0 +1,286 @@
+#ifndef ECS_SPATIAL_QUERY_H
+#define ECS_SPATIAL_QUERY_H
+
+#include <entt/entt.hpp>
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include <cstdint>
+#include <cmath>
+#include <algorithm>
+#include <limits>
+#include <optional>
+
+namespace ecs {
+
+/**
+ * SpatialQuery - Shared point index for gameplay queries
+ * Rebuilt once per tick from collider positions (SpatialQuerySystem) so
+ * targeting, homing and chase logic all read one index instead of scanning
+ * views. Points are sorted by cell row then column, so every row of a query
+ * rectangle is a single contiguous run found with one binary search.
+ *
+ * Every query takes a layer mask, points match when layer & mask != 0.
+ */
+class SpatialQuery {
+public:
+    struct Result {
+        entt::entity entity{entt::null};
+        sf::Vector2f position{0.0f, 0.0f};
+        float distance_sq{0.0f};  // Squared distance from the query centre
+    };
+
+    explicit SpatialQuery(float cell_size = 128.0f) {
+        SetCellSize(cell_size);
+    }
+
+    void SetCellSize(float size) {
+        cell_size = size > 1.0f ? size : 1.0f;
+        inv_cell_size = 1.0f / cell_size;
+    }
+
+    float GetCellSize() const { return cell_size; }
+
+    // Drop all points, keeps capacity so rebuilding each tick doesn't allocate
+    void Clear() {
+        points.clear();
+        cell_min_x = cell_min_y = std::numeric_limits<int32_t>::max();
+        cell_max_x = cell_max_y = std::numeric_limits<int32_t>::min();
+    }
+
+    void Reserve(size_t count) {
+        points.reserve(count);
+    }
+
+    void Insert(entt::entity entity, const sf::Vector2f& position, uint32_t layer) {
+        int32_t cx = CellCoord(position.x);
+        int32_t cy = CellCoord(position.y);
+        points.push_back({CellKey(cx, cy), entity, position, layer});
+
+        cell_min_x = std::min(cell_min_x, cx);
+        cell_min_y = std::min(cell_min_y, cy);
+        cell_max_x = std::max(cell_max_x, cx);
+        cell_max_y = std::max(cell_max_y, cy);
+    }
+
+    // Sort points, call once after all points are inserted
+    void Build() {
+        std::sort(points.begin(), points.end(), [](const Point& a, const Point& b) {
+            if (a.key != b.key) return a.key < b.key;
+            return entt::to_integral(a.entity) < entt::to_integral(b.entity);
+        });
+    }
+
+    // Points on layer_mask within radius of center, appended to out in index order
+    void QueryRadius(const sf::Vector2f& center, float radius, uint32_t layer_mask,
+                     std::vector<Result>& out) const {
+        float radius_sq = radius * radius;
+        ForEachPointInRect(center - sf::Vector2f(radius, radius), center + sf::Vector2f(radius, radius),
+                           layer_mask, [&](const Point& point) {
+            float distance_sq = DistanceSq(center, point.position);
+            if (distance_sq <= radius_sq) {
+                out.push_back({point.entity, point.position, distance_sq});
+            }
+        });
+    }
+
+    // Points on layer_mask inside rect, appended to out in index order (distance from the rect centre)
+    void QueryBox(const sf::FloatRect& rect, uint32_t layer_mask, std::vector<Result>& out) const {
+        sf::Vector2f min(rect.left, rect.top);
+        sf::Vector2f max(rect.left + rect.width, rect.top + rect.height);
+        sf::Vector2f center = (min + max) * 0.5f;
+        ForEachPointInRect(min, max, layer_mask, [&](const Point& point) {
+            if (point.position.x >= min.x && point.position.x <= max.x &&
+                point.position.y >= min.y && point.position.y <= max.y) {
+                out.push_back({point.entity, point.position, DistanceSq(center, point.position)});
+            }
+        });
+    }
+
+    /**
+     * Up to k points on layer_mask within max_radius of center, appended to
+     * out nearest first. Cells are visited in rings around the centre cell
+     * while a bounded max-heap (kept in the tail of out) holds the k best,
+     * the walk stops once the next ring can't hold anything closer than the
+     * current kth point.
+     */
+    void QueryNearest(const sf::Vector2f& center, size_t k, float max_radius, uint32_t layer_mask,
+                      std::vector<Result>& out) const {
+        auto first = static_cast<std::ptrdiff_t>(out.size());
+        auto farther = [](const Result& a, const Result& b) { return a.distance_sq < b.distance_sq; };
+        float kth_distance_sq = max_radius * max_radius;
+
+        VisitNearest(center, max_radius, layer_mask, kth_distance_sq, [&](const Point& point, float distance_sq) {
+            if (out.size() - first == k) {
+                std::pop_heap(out.begin() + first, out.end(), farther);
+                out.pop_back();
+            }
+            out.push_back({point.entity, point.position, distance_sq});
+            std::push_heap(out.begin() + first, out.end(), farther);
+
+            // Only points closer than the kth best are worth keeping from here on
+            if (out.size() - first == k) {
+                kth_distance_sq = out[first].distance_sq;
+            }
+        }, k);
+
+        std::sort_heap(out.begin() + first, out.end(), farther);
+    }
+
+    // Nearest point on layer_mask within max_radius of center
+    std::optional<Result> FindNearest(const sf::Vector2f& center, float max_radius, uint32_t layer_mask) const {
+        std::optional<Result> nearest;
+        float best_distance_sq = max_radius * max_radius;
+        VisitNearest(center, max_radius, layer_mask, best_distance_sq, [&](const Point& point, float distance_sq) {
+            nearest = Result{point.entity, point.position, distance_sq};
+            best_distance_sq = distance_sq;
+        }, 1);
+        return nearest;
+    }
+
+    size_t GetPointCount() const { return points.size(); }
+
+private:
+    struct Point {
+        uint64_t key;
+        entt::entity entity;
+        sf::Vector2f position;
+        uint32_t layer;
+    };
+
+    static float DistanceSq(const sf::Vector2f& a, const sf::Vector2f& b) {
+        sf::Vector2f delta = b - a;
+        return delta.x * delta.x + delta.y * delta.y;
+    }
+
+    /**
+     * Ring walk shared by the nearest queries
+     * fn(point, distance_sq) is called for points closer than bound_sq, which
+     * the caller tightens as results come in. Once count points were accepted
+     * the walk ends when no unvisited cell can beat bound_sq.
+     */
+    template<typename Fn>
+    void VisitNearest(const sf::Vector2f& center, float max_radius, uint32_t layer_mask,
+                      const float& bound_sq, Fn&& fn, size_t count) const {
+        if (count == 0 || points.empty() || layer_mask == 0) {
+            return;
+        }
+
+        int32_t cx = CellCoord(center.x);
+        int32_t cy = CellCoord(center.y);
+
+        // Rings nearer than the occupied cells are empty, start at the first that isn't
+        int32_t ring = std::max({0, cell_min_x - cx, cx - cell_max_x, cell_min_y - cy, cy - cell_max_y});
+        size_t accepted = 0;
+        for (;; ++ring) {
+            VisitRing(cx, cy, ring, layer_mask, [&](const Point& point) {
+                float distance_sq = DistanceSq(center, point.position);
+                if (distance_sq < bound_sq || (accepted < count && distance_sq == bound_sq)) {
+                    ++accepted;
+                    fn(point, distance_sq);
+                }
+            });
+
+            // Closest any point outside the rings visited so far can be
+            float reach = std::min({center.x - static_cast<float>(cx - ring) * cell_size,
+                                    static_cast<float>(cx + ring + 1) * cell_size - center.x,
+                                    center.y - static_cast<float>(cy - ring) * cell_size,
+                                    static_cast<float>(cy + ring + 1) * cell_size - center.y});
+            bool covers_index = cx - ring <= cell_min_x && cx + ring >= cell_max_x &&
+                                cy - ring <= cell_min_y && cy + ring >= cell_max_y;
+            if (covers_index || reach > max_radius || (accepted >= count && bound_sq <= reach * reach)) {
+                return;
+            }
+        }
+    }
+
+    // Points in cells [min_x, max_x] of one row, a contiguous run of the index
+    template<typename Fn>
+    void VisitRowSpan(int32_t cy, int32_t min_x, int32_t max_x, uint32_t layer_mask, Fn& fn) const {
+        auto first = std::lower_bound(points.begin(), points.end(), CellKey(min_x, cy), [](const Point& point, uint64_t key) {
+            return point.key < key;
+        });
+        uint64_t last_key = CellKey(max_x, cy);
+        for (; first != points.end() && first->key <= last_key; ++first) {
+            if (first->layer & layer_mask) {
+                fn(*first);
+            }
+        }
+    }
+
+    template<typename Fn>
+    void ForEachPointInRect(const sf::Vector2f& min, const sf::Vector2f& max, uint32_t layer_mask, Fn&& fn) const {
+        if (points.empty() || layer_mask == 0) {
+            return;
+        }
+
+        // Clamp to the occupied cells so huge query rects stay cheap
+        int32_t min_x = std::max(CellCoord(min.x), cell_min_x);
+        int32_t min_y = std::max(CellCoord(min.y), cell_min_y);
+        int32_t max_x = std::min(CellCoord(max.x), cell_max_x);
+        int32_t max_y = std::min(CellCoord(max.y), cell_max_y);
+        if (min_x > max_x) {
+            return;
+        }
+        for (int32_t cy = min_y; cy <= max_y; ++cy) {
+            VisitRowSpan(cy, min_x, max_x, layer_mask, fn);
+        }
+    }
+
+    // Cells at Chebyshev distance ring from (cx, cy), clamped to the occupied cells
+    template<typename Fn>
+    void VisitRing(int32_t cx, int32_t cy, int32_t ring, uint32_t layer_mask, Fn&& fn) const {
+        int32_t min_x = std::max(cx - ring, cell_min_x);
+        int32_t max_x = std::min(cx + ring, cell_max_x);
+        if (min_x > max_x) {
+            return;
+        }
+
+        for (int32_t row : {cy - ring, cy + ring}) {
+            if (row >= cell_min_y && row <= cell_max_y) {
+                VisitRowSpan(row, min_x, max_x, layer_mask, fn);
+            }
+            if (ring == 0) {
+                return;  // Top and bottom rows are the same cell
+            }
+        }
+
+        // Left and right columns between the top and bottom rows
+        int32_t min_y = std::max(cy - ring + 1, cell_min_y);
+        int32_t max_y = std::min(cy + ring - 1, cell_max_y);
+        for (int32_t row = min_y; row <= max_y; ++row) {
+            if (cx - ring >= cell_min_x) {
+                VisitRowSpan(row, cx - ring, cx - ring, layer_mask, fn);
+            }
+            if (cx + ring <= cell_max_x) {
+                VisitRowSpan(row, cx + ring, cx + ring, layer_mask, fn);
+            }
+        }
+    }
+
+    int32_t CellCoord(float value) const {
+        // Clamped so far away queries can't overflow the cell coordinates
+        float cell = std::floor(value * inv_cell_size);
+        return static_cast<int32_t>(std::clamp(cell, -5.0e8f, 5.0e8f));
+    }
+
+    // Row major key, sign bits flipped so keys sort like the signed coordinates
+    static uint64_t CellKey(int32_t cx, int32_t cy) {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(cy) ^ 0x80000000u) << 32) |
+               static_cast<uint64_t>(static_cast<uint32_t>(cx) ^ 0x80000000u);
+    }
+
+    float cell_size{128.0f};
+    float inv_cell_size{1.0f / 128.0f};
+
+    std::vector<Point> points;  // Sorted by key after Build
+
+    // Occupied cell bounds
+    int32_t cell_min_x{std::numeric_limits<int32_t>::max()};
+    int32_t cell_min_y{std::numeric_limits<int32_t>::max()};
+    int32_t cell_max_x{std::numeric_limits<int32_t>::min()};
+    int32_t cell_max_y{std::numeric_limits<int32_t>::min()};
+};
+
+} // namespace ecs
+
+#endif // ECS_SPATIAL_QUERY_H
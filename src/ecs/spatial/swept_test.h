@@ -0,0 +1,103 @@
+#ifndef ECS_SWEPT_TEST_H
+#define ECS_SWEPT_TEST_H
+
+#include <SFML/Graphics.hpp>
+#include <optional>
+#include <algorithm>
+#include <cmath>
+
+namespace ecs {
+
+/**
+ * SweptTest - Time of impact for shapes moving linearly over one tick
+ * Both shapes are reduced to a point moving against a static shape at the
+ * origin: start is B's centre relative to A at the beginning of the tick and
+ * motion is B's displacement relative to A over the tick. Times are fractions
+ * of the tick in [0, 1], 0 when the shapes already overlap at the start.
+ */
+class SweptTest {
+public:
+    // Point against a circle of the given radius (circle vs circle uses the radius sum)
+    static std::optional<float> Circle(const sf::Vector2f& start, const sf::Vector2f& motion, float radius) {
+        float c = Dot(start, start) - radius * radius;
+        if (c <= 0.0f) {
+            return 0.0f;
+        }
+
+        float a = Dot(motion, motion);
+        float b = Dot(start, motion);
+        if (a <= 0.0f || b >= 0.0f) {
+            return std::nullopt;  // Not moving, or moving away
+        }
+
+        float discriminant = b * b - a * c;
+        if (discriminant < 0.0f) {
+            return std::nullopt;
+        }
+
+        float time = (-b - std::sqrt(discriminant)) / a;
+        if (time > 1.0f) {
+            return std::nullopt;
+        }
+        return std::max(time, 0.0f);
+    }
+
+    // Point against an axis aligned box (rect vs rect uses the summed half extents)
+    static std::optional<float> Box(const sf::Vector2f& start, const sf::Vector2f& motion, const sf::Vector2f& half_extents) {
+        float enter = 0.0f;
+        float exit = 1.0f;
+        if (!Slab(start.x, motion.x, half_extents.x, enter, exit) ||
+            !Slab(start.y, motion.y, half_extents.y, enter, exit)) {
+            return std::nullopt;
+        }
+        return enter;
+    }
+
+    /**
+     * Point against a box with rounded corners (circle vs rect)
+     * The box expanded by the radius is tested first, entering through a
+     * corner region falls back to the circle around that corner.
+     */
+    static std::optional<float> RoundedBox(const sf::Vector2f& start, const sf::Vector2f& motion,
+                                           const sf::Vector2f& half_extents, float radius) {
+        auto time = Box(start, motion, half_extents + sf::Vector2f(radius, radius));
+        if (!time) {
+            return std::nullopt;
+        }
+
+        sf::Vector2f point = start + motion * *time;
+        if (std::abs(point.x) <= half_extents.x || std::abs(point.y) <= half_extents.y) {
+            return time;  // Entered through a face
+        }
+
+        sf::Vector2f corner(std::copysign(half_extents.x, point.x), std::copysign(half_extents.y, point.y));
+        return Circle(start - corner, motion, radius);
+    }
+
+private:
+    static float Dot(const sf::Vector2f& a, const sf::Vector2f& b) {
+        return a.x * b.x + a.y * b.y;
+    }
+
+    // Clip [enter, exit] to the times the point is within [-half, half] on one axis
+    static bool Slab(float start, float motion, float half, float& enter, float& exit) {
+        if (motion == 0.0f) {
+            return std::abs(start) <= half;
+        }
+
+        float inv_motion = 1.0f / motion;
+        float near_time = (-half - start) * inv_motion;
+        float far_time = (half - start) * inv_motion;
+        if (near_time > far_time) {
+            std::swap(near_time, far_time);
+        }
+
+        enter = std::max(enter, near_time);
+        exit = std::min(exit, far_time);
+        return enter <= exit;
+    }
+};
+
+} // namespace ecs
+
+#endif // ECS_SWEPT_TEST_H
@@ -0,0 +1,64 @@
+#ifndef ECS_AI_SYSTEM_H
+#define ECS_AI_SYSTEM_H
+
+#include "../world.h"
+#include <cmath>
+
+namespace ecs {
+
+/**
+ * AISystem - Target acquisition and IDLE / CHASE / ATTACK transitions
+ * Targets come from the world's spatial query index (nearest collider on
+ * AI::target_mask within detection_range). PATROL and FLEE are left alone
+ * so scripted behaviour can own them, only the target is kept up to date.
+ */
+class AISystem {
+public:
+    static void Update(World& world, float dt) {
+        const auto& query = world.GetSpatialQuery();
+        auto view = world.View<Transform, AI>();
+
+        for (auto entity : view) {
+            const auto& transform = view.get<Transform>(entity);
+            auto& ai = view.get<AI>(entity);
+            ai.state_time += dt;
+
+            // Keep the current target while it lives and stays in range
+            float distance = -1.0f;
+            if (ai.target != entt::null && world.IsValid(ai.target) && world.HasComponent<Transform>(ai.target)) {
+                ai.target_position = world.GetComponent<Transform>(ai.target).position;
+                sf::Vector2f to_target = ai.target_position - transform.position;
+                distance = std::sqrt(to_target.x * to_target.x + to_target.y * to_target.y);
+                if (distance > ai.detection_range) {
+                    distance = -1.0f;
+                }
+            }
+
+            if (distance < 0.0f) {
+                ai.target = entt::null;
+                if (auto nearest = query.FindNearest(transform.position, ai.detection_range, ai.target_mask)) {
+                    ai.target = nearest->entity;
+                    ai.target_position = nearest->position;
+                    distance = std::sqrt(nearest->distance_sq);
+                }
+            }
+
+            if (ai.state == AI::State::PATROL || ai.state == AI::State::FLEE) {
+                continue;
+            }
+
+            AI::State next = AI::State::IDLE;
+            if (ai.target != entt::null) {
+                next = distance <= ai.attack_range ? AI::State::ATTACK : AI::State::CHASE;
+            }
+            if (next != ai.state) {
+                ai.state = next;
+                ai.state_time = 0.0f;
+            }
+        }
+    }
+};
+
+} // namespace ecs
+
+#endif // ECS_AI_SYSTEM_H
@@ -10,7 +10,8 @@ namespace ecs {
  * AnimationSystem - Handles sprite sheet frame-by-frame animation
  *
  * Updates Animation components to advance frames based on timing,
- * and updates Sprite texture_rect to show the current frame.
+ * and updates Sprite texture_rect to show the current frame. Clips and
+ * frame rects live in the world's AnimationLibrary.
  */
 class AnimationSystem {
 public:
@@ -24,22 +25,18 @@ public:
         ATTACKING = 5
     };
 
-    // Update all animations
+    // Update all animations (chunked across workers, each entity only touches its own components)
     static void Update(World& world, float dt) {
-        auto view = world.View<Animation, Sprite>();
+        const auto& library = world.GetAnimationLibrary();
+        auto group = world.Group<Animation>(entt::get<Sprite>);
 
-        for (auto entity : view) {
-            auto& anim = view.get<Animation>(entity);
-            auto& sprite = view.get<Sprite>(entity);
-
-            // Check if current animation exists
-            auto clip_it = anim.clips.find(anim.current_animation);
-            if (clip_it == anim.clips.end()) {
+        world.ParallelEach(group, [&](entt::entity, Animation& anim, Sprite& sprite) {
+            if (anim.clip == AnimationLibrary::kNoClip) {
                 // No clip for current animation, skip
-                continue;
+                return;
             }
 
-            auto& clip = clip_it->second;
+            const auto& clip = library.GetClip(anim.clip);
 
             // Update timer
             anim.frame_timer += dt;
@@ -51,7 +48,7 @@ public:
 
                 // Handle end of animation
                 if (anim.current_frame >= clip.frame_count) {
-                    if (clip.loop) {
+                    if (anim.loop) {
                         anim.current_frame = 0;  // Loop back to start
                     } else {
                         anim.current_frame = clip.frame_count - 1;  // Stay on last frame
@@ -65,58 +62,55 @@ public:
                 }
             }
 
-            // Calculate texture rect for current frame
-            // Frame is at: (clip.start_col + current_frame, clip.row)
-            int col = clip.start_col + anim.current_frame;
-            int row = clip.row;
-
-            sprite.texture_rect = sf::IntRect(
-                col * anim.frame_size.x,
-                row * anim.frame_size.y,
-                anim.frame_size.x,
-                anim.frame_size.y
-            );
-
-            // Also update sprite size to match frame size
-            sprite.size = sf::Vector2f(anim.frame_size.x, anim.frame_size.y);
-            sprite.origin = sf::Vector2f(anim.frame_size.x / 2.0f, anim.frame_size.y / 2.0f);
-        }
+            // Sprite only changes when the frame does, rects are precomputed by the library
+            uint16_t frame = clip.first_frame + anim.current_frame;
+            if (frame == anim.shown_frame) {
+                return;
+            }
+            anim.shown_frame = frame;
+
+            const auto& rect = library.GetFrame(frame);
+            sprite.texture_rect = rect;
+            sprite.size = sf::Vector2f(rect.width, rect.height);
+            sprite.origin = sf::Vector2f(rect.width / 2.0f, rect.height / 2.0f);
+        });
     }
 
     // Play a specific animation
     static void PlayAnimation(World& world, entt::entity entity,
                              int animation_id, bool loop = true, bool priority = false) {
-        if (!world.HasComponent<Animation>(entity)) {
+        auto* anim = world.TryGetComponent<Animation>(entity);
+        if (!anim) {
             return;
         }
 
-        auto& anim = world.GetComponent<Animation>(entity);
-
         // Check if blocked by priority animation
-        if (anim.priority_active && anim.priority_id != animation_id) {
+        if (anim->priority_active && anim->priority_id != animation_id) {
             return;  // Can't switch, priority animation is playing
         }
 
         // Check if animation exists
-        if (anim.clips.find(animation_id) == anim.clips.end()) {
+        uint16_t clip = world.GetAnimationLibrary().FindClip(anim->set, animation_id);
+        if (clip == AnimationLibrary::kNoClip) {
             return;  // Animation doesn't exist
         }
 
         // Switch animation if different
-        if (anim.current_animation != animation_id) {
-            anim.current_animation = animation_id;
-            anim.current_frame = 0;
-            anim.frame_timer = 0.0f;
-            anim.finished = false;
+        if (anim->current_animation != animation_id || anim->clip != clip) {
+            anim->current_animation = static_cast<int16_t>(animation_id);
+            anim->clip = clip;
+            anim->current_frame = 0;
+            anim->frame_timer = 0.0f;
+            anim->finished = false;
         }
 
         // Update loop setting
-        anim.clips[animation_id].loop = loop;
+        anim->loop = loop;
 
         // Set/clear priority
         if (priority) {
-            anim.priority_active = true;
-            anim.priority_id = animation_id;
+            anim->priority_active = true;
+            anim->priority_id = static_cast<int16_t>(animation_id);
         }
     }
 
@@ -51,7 +51,7 @@ public:
         std::vector<entt::entity> to_despawn;
 
         // Check enemies and bullets
-        auto view = world.View<Transform>();
+        auto view = world.View<Transform>(entt::exclude<Inactive>);
 
         for (auto entity : view) {
             // Skip player
@@ -2,8 +2,11 @@
 #define ECS_COLLISION_SYSTEM_H
 
 #include "../world.h"
+#include "util/i_threaded_workload.h"
 #include <vector>
 #include <functional>
+#include <optional>
+#include <algorithm>
 #include <cmath>
 
 namespace ecs {
@@ -23,60 +26,143 @@ struct CollisionPair {
 class CollisionSystem {
 public:
     using CollisionCallback = std::function<void(entt::entity, entt::entity, const sf::Vector2f&)>;
+    using ContactCallback = std::function<void(ContactEvent, const Contact&)>;
+
+    /**
+     * Detect collisions and report them as contact events
+     * Pairs that keep touching report STAY instead of a fresh collision,
+     * so handlers can act once on ENTER or tick on their own timer.
+     */
+    static void UpdateContacts(World& world, float dt, ContactCallback callback,
+                               IThreadedWorkload& workload, size_t thread_count) {
+        auto& contact_cache = world.GetContactCache();
+        contact_cache.Begin();
+
+        DetectCollisions(world, [&](entt::entity a, entt::entity b, const sf::Vector2f& point) {
+            contact_cache.Add(a, b, point);
+        }, workload, thread_count);
+
+        contact_cache.End(dt, callback);
+    }
 
     // Detect all collisions and invoke callback
     static void DetectCollisions(World& world, CollisionCallback callback) {
-        std::vector<CollisionPair> collisions;
+        // Broad phase - rebuild the spatial hash grid from the collider view
+        auto& grid = world.GetSpatialGrid();
+        BuildBroadPhase(world, grid);
+
+        // Narrow phase - layer check and shape test per batch
+        auto& narrow_phase = world.GetNarrowPhase();
+        GatherPairs(grid, SpatialHashGrid::CellRange{}, narrow_phase);
+        narrow_phase.Execute();
+
+        // Invoke callback for each collision, hits are in broad phase order
+        for (const auto& hit : narrow_phase.GetHits()) {
+            callback(hit.entity_a, hit.entity_b, hit.point);
+        }
+    }
 
-        // Get all entities with collision components
-        std::vector<entt::entity> entities;
-        auto view = world.View<Transform, Collision>();
-        for (auto entity : view) {
-            entities.push_back(entity);
+    /**
+     * Detect collisions on up to thread_count workers
+     * The grid is split into cell key ranges, one per worker, and a pair is
+     * owned by the range holding its first shared cell. Worker hits are
+     * merged bucket pair by bucket pair in range order, which is the order
+     * the single threaded walk visits them, so callbacks fire identically.
+     */
+    static void DetectCollisions(World& world, CollisionCallback callback,
+                                 IThreadedWorkload& workload, size_t thread_count) {
+        if (thread_count <= 1) {
+            DetectCollisions(world, callback);
+            return;
         }
 
-        // Broad phase - check all pairs (O(n^2) - will optimize with QuadTree later)
-        for (size_t i = 0; i < entities.size(); ++i) {
-            for (size_t j = i + 1; j < entities.size(); ++j) {
-                auto entity_a = entities[i];
-                auto entity_b = entities[j];
+        auto& grid = world.GetSpatialGrid();
+        BuildBroadPhase(world, grid);
 
-                const auto& transform_a = world.GetComponent<Transform>(entity_a);
-                const auto& collision_a = world.GetComponent<Collision>(entity_a);
-                const auto& transform_b = world.GetComponent<Transform>(entity_b);
-                const auto& collision_b = world.GetComponent<Collision>(entity_b);
+        const auto& ranges = grid.PartitionCells(thread_count);
+        world.SetNarrowPhaseWorkerCount(ranges.size());
 
-                // Skip if either collision is disabled
-                if (!collision_a.enabled || !collision_b.enabled) {
-                    continue;
+        for (size_t worker = 0; worker < ranges.size(); ++worker) {
+            workload.AddTask([&world, &grid, &ranges, worker]() {
+                auto& narrow_phase = world.GetNarrowPhase(worker);
+                GatherPairs(grid, ranges[worker], narrow_phase);
+                narrow_phase.Execute();
+            });
+        }
+        workload.Join();
+
+        // Stable merge - each worker's hits are sorted and segmented by bucket pair
+        auto& cursors = world.GetNarrowPhaseCursors();
+        cursors.assign(ranges.size(), 0);
+        for (size_t bucket_pair = 0; bucket_pair < grid.GetBucketPairCount(); ++bucket_pair) {
+            for (size_t worker = 0; worker < ranges.size(); ++worker) {
+                const auto& narrow_phase = world.GetNarrowPhase(worker);
+                const auto& hits = narrow_phase.GetHits();
+                uint32_t segment_end = narrow_phase.GetSegmentEnds()[bucket_pair];
+
+                auto& cursor = cursors[worker];
+                for (; cursor < hits.size() && hits[cursor].sequence < segment_end; ++cursor) {
+                    callback(hits[cursor].entity_a, hits[cursor].entity_b, hits[cursor].point);
                 }
+            }
+        }
+    }
 
-                // Check collision layers
-                if ((collision_a.layer & collision_b.mask) == 0 &&
-                    (collision_b.layer & collision_a.mask) == 0) {
-                    continue;
-                }
+    // Queue the candidate pairs of a cell range, one segment per bucket pair
+    static void GatherPairs(const SpatialHashGrid& grid, const SpatialHashGrid::CellRange& range,
+                            NarrowPhaseBatch& narrow_phase) {
+        narrow_phase.Clear();
+        for (size_t bucket_pair = 0; bucket_pair < grid.GetBucketPairCount(); ++bucket_pair) {
+            grid.ForEachCandidatePair(bucket_pair, range, [&](const SpatialProxy& proxy_a, const SpatialProxy& proxy_b) {
+                narrow_phase.Add(proxy_a, proxy_b);
+            });
+            narrow_phase.EndSegment();
+        }
+    }
 
-                // Narrow phase - actual collision test
-                sf::Vector2f pos_a = transform_a.position + collision_a.offset;
-                sf::Vector2f pos_b = transform_b.position + collision_b.offset;
+    // Insert every enabled collider into the grid
+    static void BuildBroadPhase(World& world, SpatialHashGrid& grid) {
+        grid.Clear();
 
-                if (TestCollision(collision_a, pos_a, collision_b, pos_b)) {
-                    // Calculate collision point (midpoint)
-                    sf::Vector2f collision_point = (pos_a + pos_b) * 0.5f;
+        auto view = world.View<Transform, Collision>(entt::exclude<Inactive>);
+        grid.Reserve(view.size_hint());
 
-                    collisions.push_back({entity_a, entity_b, collision_point});
-                }
+        for (auto entity : view) {
+            const auto& transform = view.get<Transform>(entity);
+            const auto& collision = view.get<Collision>(entity);
+
+            // Disabled colliders never pair, keep them out of the grid
+            if (!collision.enabled) {
+                continue;
             }
-        }
 
-        // Invoke callback for each collision
-        for (const auto& collision : collisions) {
-            callback(collision.entity_a, collision.entity_b, collision.collision_point);
+            sf::Vector2f position = transform.position + collision.offset;
+            sf::Vector2f start = transform.last_position + collision.offset;
+            sf::Vector2f extent = collision.shape == Collision::Shape::CIRCLE
+                ? sf::Vector2f(collision.radius, collision.radius)
+                : collision.rect_size * 0.5f;
+
+            // Bounds cover the whole move so fast colliders can't skip a cell
+            sf::Vector2f swept_min(std::min(start.x, position.x), std::min(start.y, position.y));
+            sf::Vector2f swept_max(std::max(start.x, position.x), std::max(start.y, position.y));
+
+            grid.Insert({
+                .entity = entity,
+                .position = position,
+                .start = start,
+                .min = swept_min - extent,
+                .max = swept_max + extent,
+                .layer = collision.layer,
+                .mask = collision.mask,
+                .shape = collision.shape,
+                .extent = extent
+            });
         }
+
+        grid.Build();
     }
 
-    // Test collision between two collision components
+    // Test collision between two collision components (single pair reference path)
     static bool TestCollision(const Collision& a, const sf::Vector2f& pos_a,
                              const Collision& b, const sf::Vector2f& pos_b) {
         if (a.shape == Collision::Shape::CIRCLE && b.shape == Collision::Shape::CIRCLE) {
@@ -93,6 +179,26 @@ public:
         }
     }
 
+    /**
+     * Swept test between two colliders moving from start to end over the tick
+     * Returns the time of impact as a fraction of the tick
+     */
+    static std::optional<float> TestSweptCollision(const Collision& a, const sf::Vector2f& start_a, const sf::Vector2f& end_a,
+                                                   const Collision& b, const sf::Vector2f& start_b, const sf::Vector2f& end_b) {
+        sf::Vector2f relative_start = start_b - start_a;
+        sf::Vector2f relative_motion = (end_b - start_b) - (end_a - start_a);
+
+        if (a.shape == Collision::Shape::CIRCLE && b.shape == Collision::Shape::CIRCLE) {
+            return SweptTest::Circle(relative_start, relative_motion, a.radius + b.radius);
+        } else if (a.shape == Collision::Shape::RECTANGLE && b.shape == Collision::Shape::RECTANGLE) {
+            return SweptTest::Box(relative_start, relative_motion, (a.rect_size + b.rect_size) * 0.5f);
+        } else if (a.shape == Collision::Shape::RECTANGLE) {
+            return SweptTest::RoundedBox(relative_start, relative_motion, a.rect_size * 0.5f, b.radius);
+        } else {
+            return SweptTest::RoundedBox(-relative_start, -relative_motion, b.rect_size * 0.5f, a.radius);
+        }
+    }
+
 private:
     static bool TestCircleCircle(const sf::Vector2f& pos_a, float radius_a,
                                  const sf::Vector2f& pos_b, float radius_b) {
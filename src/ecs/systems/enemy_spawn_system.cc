@@ -11,6 +11,9 @@ std::mt19937 EnemySpawnSystem::rng;
 std::uniform_real_distribution<float> EnemySpawnSystem::dist01(0.0f, 1.0f);
 bool EnemySpawnSystem::enabled = true;
 int EnemySpawnSystem::total_spawned = 0;
+std::vector<EnemySpawnSystem::PendingSpawn> EnemySpawnSystem::pending_spawns;
+std::vector<sf::Vector2f> EnemySpawnSystem::batch_positions;
+std::vector<entt::entity> EnemySpawnSystem::batch_spawned;
 
 void EnemySpawnSystem::Initialize(unsigned int seed) {
     if (seed == 0) {
@@ -26,7 +29,7 @@ void EnemySpawnSystem::AddWave(const SpawnWaveConfig& wave) {
     waves.push_back(wave);
 }
 
-void EnemySpawnSystem::AddContinuousWave(const std::string& enemy_type,
+void EnemySpawnSystem::AddContinuousWave(EnemyHandle enemy_type,
                                         float interval,
                                         int max_concurrent,
                                         float interval_variance) {
@@ -40,7 +43,7 @@ void EnemySpawnSystem::AddContinuousWave(const std::string& enemy_type,
     AddWave(wave);
 }
 
-void EnemySpawnSystem::AddDiscreteWave(const std::vector<std::string>& enemy_pool,
+void EnemySpawnSystem::AddDiscreteWave(const std::vector<EnemyHandle>& enemy_pool,
                                       int count,
                                       float delay,
                                       float spawn_interval) {
@@ -55,7 +58,17 @@ void EnemySpawnSystem::AddDiscreteWave(const std::vector<std::string>& enemy_poo
     AddWave(wave);
 }
 
-bool EnemySpawnSystem::LoadSpawnWaves(const std::string& filepath) {
+bool EnemySpawnSystem::LoadSpawnWaves(const std::string& filepath, const ConfigLoader& config) {
+    // Enemy names are resolved here so spawning never hashes a string
+    auto add_enemy = [&](SpawnWaveConfig& wave, const std::string& name) {
+        auto handle = config.FindEnemy(name);
+        if (handle == EnemyHandle::INVALID) {
+            std::cerr << "Warning: Unknown enemy type '" << name << "' in spawn waves" << std::endl;
+            return;
+        }
+        wave.enemy_pool.push_back(handle);
+    };
+
     try {
         auto config = toml::parse_file(filepath);
 
@@ -102,12 +115,12 @@ bool EnemySpawnSystem::LoadSpawnWaves(const std::string& filepath) {
                 } else if (property == "count") {
                     wave_map[wave_num].max_concurrent = value.value<int>().value();
                 } else if (property == "enemy") {
-                    wave_map[wave_num].enemy_pool.push_back(value.value<std::string>().value());
+                    add_enemy(wave_map[wave_num], value.value<std::string>().value());
                 } else if (property == "enemies") {
                     // Support array of enemies
                     if (value.is_array()) {
                         for (const auto& enemy : *value.as_array()) {
-                            wave_map[wave_num].enemy_pool.push_back(enemy.value<std::string>().value());
+                            add_enemy(wave_map[wave_num], enemy.value<std::string>().value());
                         }
                     }
                 } else if (property == "interval") {
@@ -173,36 +186,53 @@ void EnemySpawnSystem::Update(World& world,
         // Update timer
         wave.timer += dt;
 
-        // Calculate actual spawn interval with variance
-        float spawn_interval = wave.interval;
-        if (wave.interval_variance > 0.0f) {
-            float variance = GetRandomVariance() * wave.interval_variance;
-            spawn_interval += variance;
-        }
+        // Queue every spawn that came due this update, a short interval can owe several
+        while (!wave.completed) {
+            // Calculate actual spawn interval with variance
+            float spawn_interval = wave.interval;
+            if (wave.interval_variance > 0.0f) {
+                float variance = GetRandomVariance() * wave.interval_variance;
+                spawn_interval += variance;
+            }
 
-        // Check if it's time to spawn
-        if (wave.timer >= spawn_interval) {
-            // Try to spawn enemy
-            if (TrySpawnEnemy(world, wave, factory, bounds, textureAtlas)) {
-                // Reset timer
-                wave.timer = 0.0f;
-
-                // Increment spawn count
-                wave.spawned_count++;
-                wave.alive_count++;
-                total_spawned++;
-
-                // Check if discrete wave is complete
-                if (!wave.continuous && wave.spawned_count >= wave.max_concurrent) {
-                    wave.completed = true;
-                }
+            // Check if it's time to spawn
+            if (wave.timer < spawn_interval) {
+                break;
+            }
+
+            // Try to spawn enemy (instantiated with the rest of this update's spawns)
+            if (!TryQueueSpawn(wave, factory, bounds)) {
+                // Blocked by the limit, owe one spawn rather than a burst once it frees up
+                wave.timer = std::max(spawn_interval, 0.0f);
+                break;
+            }
+
+            // Keep the remainder so spawns stay on the interval
+            wave.timer = spawn_interval > 0.0f ? wave.timer - spawn_interval : 0.0f;
+
+            // Increment spawn count
+            wave.spawned_count++;
+            wave.alive_count++;
+            total_spawned++;
+
+            // Check if discrete wave is complete
+            if (!wave.continuous && wave.spawned_count >= wave.max_concurrent) {
+                wave.completed = true;
+            }
+
+            // No interval means one spawn per update
+            if (spawn_interval <= 0.0f) {
+                break;
             }
         }
     }
+
+    SpawnPending(factory);
 }
 
 void EnemySpawnSystem::Clear() {
     waves.clear();
+    pending_spawns.clear();
     total_spawned = 0;
 }
 
@@ -222,11 +252,9 @@ bool EnemySpawnSystem::IsEnabled() {
     return enabled;
 }
 
-bool EnemySpawnSystem::TrySpawnEnemy(World& world,
-                                    SpawnWaveConfig& wave,
-                                    EntityFactory& factory,
-                                    const sf::FloatRect& bounds,
-                                    ITextureAtlas& textureAtlas) {
+bool EnemySpawnSystem::TryQueueSpawn(SpawnWaveConfig& wave,
+                                     EntityFactory& factory,
+                                     const sf::FloatRect& bounds) {
     // Check if we've reached the concurrent limit
     if (wave.max_concurrent > 0 && wave.alive_count >= wave.max_concurrent) {
         return false;
@@ -239,30 +267,45 @@ bool EnemySpawnSystem::TrySpawnEnemy(World& world,
     }
 
     // Select random enemy type from pool
-    std::string enemy_type = SelectRandomEnemyType(wave.enemy_pool);
+    EnemyHandle enemy_type = SelectRandomEnemyType(wave.enemy_pool);
+
+    const EnemyPrefab* prefab = factory.GetPrefab(enemy_type);
+    if (!prefab) {
+        std::cerr << "Warning: Failed to create enemy of type " << static_cast<int>(enemy_type) << std::endl;
+        return false;
+    }
 
     // Get random spawn position
     sf::Vector2f spawn_pos = GetRandomSpawnPosition(bounds, wave.position_variance);
 
-    // Get texture for enemy (try to load from atlas)
-    sf::Texture* texture = nullptr;
-    // Note: EntityFactory will handle texture loading internally via ConfigLoader
+    pending_spawns.push_back({prefab, spawn_pos});
+    return true;
+}
 
-    // Create enemy entity
-    try {
-        entt::entity enemy = factory.CreateEnemy(enemy_type, spawn_pos, texture);
+void EnemySpawnSystem::SpawnPending(EntityFactory& factory) {
+    if (pending_spawns.empty()) {
+        return;
+    }
 
-        // Verify entity was created
-        if (enemy != entt::null && world.IsValid(enemy)) {
-            return true;
-        } else {
-            std::cerr << "Warning: Failed to create enemy of type '" << enemy_type << "'" << std::endl;
-            return false;
+    // Group by prefab in first-queued order, each group is one batch
+    batch_spawned.clear();
+    for (size_t i = 0; i < pending_spawns.size(); ++i) {
+        const EnemyPrefab* prefab = pending_spawns[i].prefab;
+        if (!prefab) {
+            continue;  // Already spawned with an earlier group
         }
-    } catch (const std::exception& e) {
-        std::cerr << "Error creating enemy '" << enemy_type << "': " << e.what() << std::endl;
-        return false;
+
+        batch_positions.clear();
+        for (size_t j = i; j < pending_spawns.size(); ++j) {
+            if (pending_spawns[j].prefab == prefab) {
+                batch_positions.push_back(pending_spawns[j].position);
+                pending_spawns[j].prefab = nullptr;
+            }
+        }
+        factory.SpawnBatch(*prefab, batch_positions, batch_spawned);
     }
+
+    pending_spawns.clear();
 }
 
 sf::Vector2f EnemySpawnSystem::GetRandomSpawnPosition(const sf::FloatRect& bounds,
@@ -282,9 +325,9 @@ sf::Vector2f EnemySpawnSystem::GetRandomSpawnPosition(const sf::FloatRect& bound
     return sf::Vector2f(x, y);
 }
 
-std::string EnemySpawnSystem::SelectRandomEnemyType(const std::vector<std::string>& enemy_pool) {
+EnemyHandle EnemySpawnSystem::SelectRandomEnemyType(const std::vector<EnemyHandle>& enemy_pool) {
     if (enemy_pool.empty()) {
-        return "";
+        return EnemyHandle::INVALID;
     }
 
     if (enemy_pool.size() == 1) {
@@ -19,7 +19,7 @@ namespace ecs {
  */
 struct SpawnWaveConfig {
     // Core spawn configuration
-    std::vector<std::string> enemy_pool;    // Pool of enemy types to spawn from
+    std::vector<EnemyHandle> enemy_pool;    // Pool of enemy types to spawn from (resolved at load)
     float interval;                          // Base spawn interval (seconds)
     float interval_variance;                 // ±variance for timing randomness (0.0 = no variance)
     int max_concurrent;                      // Max enemies alive from this wave (0 = unlimited)
@@ -74,7 +74,7 @@ public:
      * @param max_concurrent Max concurrent enemies (0 = unlimited)
      * @param interval_variance Optional timing variance (default 0.0)
      */
-    static void AddContinuousWave(const std::string& enemy_type,
+    static void AddContinuousWave(EnemyHandle enemy_type,
                                   float interval,
                                   int max_concurrent = 0,
                                   float interval_variance = 0.0f);
@@ -86,7 +86,7 @@ public:
      * @param delay Delay before spawning this wave (seconds)
      * @param spawn_interval Interval between individual spawns in the wave
      */
-    static void AddDiscreteWave(const std::vector<std::string>& enemy_pool,
+    static void AddDiscreteWave(const std::vector<EnemyHandle>& enemy_pool,
                                int count,
                                float delay,
                                float spawn_interval = 0.5f);
@@ -94,9 +94,10 @@ public:
     /**
      * Load spawn waves from TOML configuration
      * @param filepath Path to enemies.toml with [spawn_waves] section
+     * @param config Loaded enemy configs, used to resolve enemy names to handles
      * @return true if loaded successfully
      */
-    static bool LoadSpawnWaves(const std::string& filepath);
+    static bool LoadSpawnWaves(const std::string& filepath, const ConfigLoader& config);
 
     /**
      * Update spawn system - spawns enemies based on waves and timing
@@ -149,15 +150,29 @@ private:
     static bool enabled;
     static int total_spawned;
 
+    // Spawn picked by a wave this update, instantiated after all waves ran
+    struct PendingSpawn {
+        const EnemyPrefab* prefab;
+        sf::Vector2f position;
+    };
+    static std::vector<PendingSpawn> pending_spawns;
+
+    // SpawnPending scratch, kept for their capacity
+    static std::vector<sf::Vector2f> batch_positions;
+    static std::vector<entt::entity> batch_spawned;
+
+    /**
+     * Try to queue an enemy spawn from a wave
+     * @return true if a spawn was queued
+     */
+    static bool TryQueueSpawn(SpawnWaveConfig& wave,
+                              EntityFactory& factory,
+                              const sf::FloatRect& bounds);
+
     /**
-     * Try to spawn an enemy from a wave
-     * @return true if enemy was spawned
+     * Instantiate queued spawns, one SpawnBatch per prefab
      */
-    static bool TrySpawnEnemy(World& world,
-                             SpawnWaveConfig& wave,
-                             EntityFactory& factory,
-                             const sf::FloatRect& bounds,
-                             ITextureAtlas& textureAtlas);
+    static void SpawnPending(EntityFactory& factory);
 
     /**
      * Get random spawn position within bounds
@@ -171,7 +186,7 @@ private:
     /**
      * Select random enemy type from pool
      */
-    static std::string SelectRandomEnemyType(const std::vector<std::string>& enemy_pool);
+    static EnemyHandle SelectRandomEnemyType(const std::vector<EnemyHandle>& enemy_pool);
 
     /**
      * Get random variance value [-1.0, 1.0]
@@ -13,13 +13,9 @@ class HealthSystem {
 public:
     // Update shield regeneration
     static void Update(World& world, float dt) {
-        auto view = world.View<Health>();
-
-        for (auto entity : view) {
-            auto& health = view.get<Health>(entity);
-
+        world.ParallelEach<Health>([&](entt::entity, Health& health) {
             if (health.dead || health.invulnerable) {
-                continue;
+                return;
             }
 
             // Update shield regeneration timer
@@ -34,7 +30,7 @@ public:
                     }
                 }
             }
-        }
+        });
     }
 
     // Apply damage to an entity
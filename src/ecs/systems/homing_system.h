@@ -0,0 +1,62 @@
+#ifndef ECS_HOMING_SYSTEM_H
+#define ECS_HOMING_SYSTEM_H
+
+#include "../world.h"
+#include <cmath>
+#include <algorithm>
+
+namespace ecs {
+
+/**
+ * HomingSystem - Turns homing projectiles toward their target
+ * Locks onto the nearest collider on Homing::target_mask within range (from
+ * the world's spatial query index) and rotates the velocity by at most
+ * turn_rate per second, speed is unchanged. Run before movement.
+ */
+class HomingSystem {
+public:
+    static void Update(World& world, float dt) {
+        const auto& query = world.GetSpatialQuery();
+        auto view = world.View<Transform, Homing>(entt::exclude<Inactive>);
+
+        for (auto entity : view) {
+            auto& transform = view.get<Transform>(entity);
+            auto& homing = view.get<Homing>(entity);
+            if (homing.range <= 0.0f) {
+                continue;  // Pooled bullet fired without homing
+            }
+
+            // Drop locks on destroyed targets, then reacquire
+            if (homing.target != entt::null && (!world.IsValid(homing.target) || !world.HasComponent<Transform>(homing.target))) {
+                homing.target = entt::null;
+            }
+            if (homing.target == entt::null) {
+                if (auto nearest = query.FindNearest(transform.position, homing.range, homing.target_mask)) {
+                    homing.target = nearest->entity;
+                }
+            }
+            if (homing.target == entt::null) {
+                continue;  // Nothing in range, fly straight
+            }
+
+            sf::Vector2f to_target = world.GetComponent<Transform>(homing.target).position - transform.position;
+            float speed = std::sqrt(transform.velocity.x * transform.velocity.x +
+                                    transform.velocity.y * transform.velocity.y);
+            if (speed < 0.001f || (to_target.x == 0.0f && to_target.y == 0.0f)) {
+                continue;
+            }
+
+            // Signed angle from the heading to the target, clamped to this tick's turn
+            float heading = std::atan2(transform.velocity.y, transform.velocity.x);
+            float turn = std::remainder(std::atan2(to_target.y, to_target.x) - heading, 6.28318f);
+            float max_turn = homing.turn_rate * dt;
+            heading += std::clamp(turn, -max_turn, max_turn);
+
+            transform.velocity = sf::Vector2f(std::cos(heading), std::sin(heading)) * speed;
+        }
+    }
+};
+
+} // namespace ecs
+
+#endif // ECS_HOMING_SYSTEM_H
@@ -11,21 +11,21 @@ namespace ecs {
  */
 class LifetimeSystem {
 public:
-    // Update lifetimes and collect expired entities
-    static std::vector<entt::entity> Update(World& world, float dt) {
-        std::vector<entt::entity> expired_entities;
-        auto view = world.View<Lifetime>();
-
-        for (auto entity : view) {
-            auto& lifetime = view.get<Lifetime>(entity);
-            lifetime.elapsed += dt;
-
-            if (lifetime.elapsed >= lifetime.duration) {
-                expired_entities.push_back(entity);
-            }
-        }
-
-        return expired_entities;
+    // Update lifetimes, expired is refilled with the entities whose time ran out
+    static void Update(World& world, float dt, std::vector<entt::entity>& expired,
+                       ChunkBuffers<entt::entity>& chunk_buffers) {
+        expired.clear();
+        // Non-owning group keeps the live (not pooled at rest) lifetimes packed for chunking
+        auto group = world.Group(entt::get<Lifetime>, entt::exclude<Inactive>);
+
+        world.ParallelCollect(group, expired, chunk_buffers,
+            [&](std::vector<entt::entity>& buffer, entt::entity entity, Lifetime& lifetime) {
+                lifetime.elapsed += dt;
+
+                if (lifetime.elapsed >= lifetime.duration) {
+                    buffer.push_back(entity);
+                }
+            });
     }
 
     // Check if entity is expired
@@ -3,6 +3,8 @@
 
 #include "../world.h"
 #include <cmath>
+#include <limits>
+#include <optional>
 
 namespace ecs {
 
@@ -11,14 +13,11 @@ namespace ecs {
  */
 class MovementSystem {
 public:
-    // Update all entities with Transform and Movement components
+    // Update all entities with Transform and Movement components (chunked across workers)
     static void Update(World& world, float dt) {
-        auto view = world.View<Transform, Movement>();
-
-        for (auto entity : view) {
-            auto& transform = view.get<Transform>(entity);
-            auto& movement = view.get<Movement>(entity);
+        auto group = world.Group<Movement>(entt::get<Transform>);
 
+        world.ParallelEach(group, [&](entt::entity entity, Movement& movement, Transform& transform) {
             // Store last position for interpolation
             transform.last_position = transform.position;
 
@@ -50,37 +49,32 @@ public:
                     movement.orbit_center += world_velocity * dt;
                 }
             }
-
-            // AUTO-ROTATE: Point sprite in direction of velocity
-            if (transform.velocity.x != 0.0f || transform.velocity.y != 0.0f) {
-                float angle = std::atan2(transform.velocity.y, transform.velocity.x);
-                transform.rotation = angle * (180.0f / 3.14159f) + 90.0f;
-                // +90° adjusts for vertical shooter sprite orientation (bottom points down → right)
-            }
-        }
+        });
     }
 
     // Update entities with only Transform (direct velocity control)
     static void UpdateSimple(World& world, float dt) {
-        auto view = world.View<Transform>();
-
-        for (auto entity : view) {
-            // Skip entities that have Movement component (handled by main Update)
-            if (world.HasComponent<Movement>(entity)) {
-                continue;
-            }
+        // Entities with a Movement component are handled by the main Update
+        auto group = world.Group(entt::get<Transform>, entt::exclude<Movement, Inactive>);
 
-            auto& transform = view.get<Transform>(entity);
+        world.ParallelEach(group, [&](entt::entity, Transform& transform) {
             transform.last_position = transform.position;
             transform.position += transform.velocity * dt;
+        });
+    }
+
+    // AUTO-ROTATE: Point sprites in direction of velocity (bullets, enemies, particles, etc.)
+    // Render-only, kept out of the movement loops so they never touch Sprite
+    static void UpdateFacing(World& world) {
+        auto group = world.Group<Transform, Sprite>(entt::get<>, entt::exclude<Inactive>);
 
-            // AUTO-ROTATE: Point sprite in direction of velocity (for bullets, particles, etc.)
+        world.ParallelEach(group, [&](entt::entity, const Transform& transform, Sprite& sprite) {
             if (transform.velocity.x != 0.0f || transform.velocity.y != 0.0f) {
                 float angle = std::atan2(transform.velocity.y, transform.velocity.x);
-                transform.rotation = angle * (180.0f / 3.14159f) + 90.0f;
-                // +90° adjusts for vertical shooter sprite orientation
+                sprite.rotation = angle * (180.0f / 3.14159f) + 90.0f;
+                // +90° adjusts for vertical shooter sprite orientation (bottom points down → right)
             }
-        }
+        });
     }
 
 private:
@@ -136,33 +130,32 @@ private:
 
             case Movement::Pattern::FOLLOW_TARGET:
                 {
-                    // Find player entity to chase
-                    auto players = world.View<PlayerTag, Transform>();
-                    bool found_player = false;
-
-                    for (auto player : players) {
-                        // Get first player
-                        const auto& player_transform = world.GetComponent<Transform>(player);
+                    // Chase the AI's target if it has one, else the nearest collider on target_mask
+                    // (the AI's copy of the target position, other entities' transforms may be moving)
+                    std::optional<sf::Vector2f> target;
+                    auto* ai = world.TryGetComponent<AI>(entity);
+                    if (ai && ai->target != entt::null) {
+                        target = ai->target_position;
+                    } else if (auto nearest = world.GetSpatialQuery().FindNearest(
+                                   transform.position, std::numeric_limits<float>::infinity(), movement.target_mask)) {
+                        target = nearest->position;
+                    }
 
-                        // Calculate direction to player
-                        sf::Vector2f to_player = player_transform.position - transform.position;
-                        float distance = std::sqrt(to_player.x * to_player.x + to_player.y * to_player.y);
+                    if (target) {
+                        // Calculate direction to target
+                        sf::Vector2f to_target = *target - transform.position;
+                        float distance = std::sqrt(to_target.x * to_target.x + to_target.y * to_target.y);
 
                         if (distance > 0.001f) {
                             // Normalize direction and apply speed
-                            sf::Vector2f direction = to_player / distance;
+                            sf::Vector2f direction = to_target / distance;
                             transform.velocity = direction * movement.speed;
                         } else {
-                            // At player position, stop
+                            // At target position, stop
                             transform.velocity = sf::Vector2f(0.0f, 0.0f);
                         }
-
-                        found_player = true;
-                        break;  // Only chase first player
-                    }
-
-                    if (!found_player) {
-                        // No player found, move in default direction
+                    } else {
+                        // No target found, move in default direction
                         transform.velocity = movement.direction * movement.speed;
                     }
                 }
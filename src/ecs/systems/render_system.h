@@ -5,8 +5,6 @@
 #include "../../renderer/i_glow_shader_renderer.h"
 #include "../../renderer/i_renderer.h"
 #include <SFML/Graphics.hpp>
-#include <algorithm>
-#include <vector>
 
 namespace ecs {
 
@@ -15,55 +13,42 @@ namespace ecs {
  */
 class RenderSystem {
 public:
-    // Render all entities with Sprite and Transform components
+    /**
+     * Render all entities with Sprite and Transform components
+     * Draw records are refreshed in the group's packed order, then the
+     * RenderQueue's buckets are walked back to front (lower layers first).
+     * Bucket membership is kept by registry signals, so nothing is sorted
+     * or looked up per entity here. Each bucket shares a layer and texture
+     * and is drawn by the SpriteBatcher as one vertex array.
+     */
     static void Render(World& world, sf::RenderTarget& target, float interpolation = 1.0f) {
-        // Collect all renderable entities
-        std::vector<entt::entity> entities;
-        auto view = world.View<Transform, Sprite>();
-
-        for (auto entity : view) {
-            const auto& sprite = view.get<Sprite>(entity);
-            if (sprite.visible) {
-                entities.push_back(entity);
-            }
-        }
-
-        // Sort by layer (lower layers drawn first)
-        std::sort(entities.begin(), entities.end(), [&world](entt::entity a, entt::entity b) {
-            const auto& sprite_a = world.GetComponent<Sprite>(a);
-            const auto& sprite_b = world.GetComponent<Sprite>(b);
-            return sprite_a.layer < sprite_b.layer;
-        });
-
-        // Render each entity
-        for (auto entity : entities) {
-            const auto& transform = world.GetComponent<Transform>(entity);
-            const auto& sprite = world.GetComponent<Sprite>(entity);
-            const auto input = world.TryGetComponent<Input>(entity);
-
+        auto& queue = world.GetRenderQueue();
+        auto group = world.Group<Transform, Sprite>(entt::get<>, entt::exclude<Inactive>);
+        world.ParallelEach(group, [&](entt::entity entity, const Transform& transform, const Sprite& sprite) {
             // Interpolate position for smooth rendering
-            sf::Vector2f render_pos = Interpolate(
-                transform.last_position,
-                transform.position,
-                interpolation
-            );
+            queue.Write(entity, Interpolate(transform.last_position, transform.position, interpolation), sprite);
+        });
 
-            RenderSprite(target, sprite, render_pos, transform.rotation, transform.scale);
+        auto& batcher = world.GetSpriteBatcher();
+        batcher.Begin();
+        queue.ForEach([&](const RenderQueue::Bucket& bucket) {
+            batcher.Draw(target, bucket);
+        });
 
-            if (input) {
-                RenderAim(target, render_pos, input->mouse_position);
-            }
+        // Aim lines on top, only the player has Input
+        auto aiming = world.View<Transform, Input>(entt::exclude<Inactive>);
+        for (auto [entity, transform, input] : aiming.each()) {
+            RenderAim(target, Interpolate(transform.last_position, transform.position, interpolation),
+                      input.mouse_position);
         }
     }
 
     // Render glow effects using an IRenderer (uses renderer's AddGlow method)
+    // Flushed at the end so queued glow quads land beneath the sprites drawn next
     static void RenderGlow(World& world, class IRenderer& renderer, float interpolation = 1.0f) {
-        auto view = world.View<Transform, Glow>();
-
-        for (auto entity : view) {
-            const auto& transform = view.get<Transform>(entity);
-            const auto& glow = view.get<Glow>(entity);
+        auto group = world.Group<Glow>(entt::get<Transform>, entt::exclude<Inactive>);
 
+        for (auto [entity, glow, transform] : group.each()) {
             if (!glow.enabled) continue;
 
             // Interpolate position for smooth rendering
@@ -76,11 +61,13 @@ public:
             // Add glow at entity position
             renderer.AddGlow(render_pos, glow.color, glow.attenuation);
         }
+
+        renderer.FlushGlow();
     }
 
     // Render debug collision shapes
     static void RenderDebug(World& world, sf::RenderTarget& target) {
-        auto view = world.View<Transform, Collision>();
+        auto view = world.View<Transform, Collision>(entt::exclude<Inactive>);
 
         for (auto entity : view) {
             const auto& transform = view.get<Transform>(entity);
@@ -110,29 +97,6 @@ public:
     }
 
 private:
-    static void RenderSprite(sf::RenderTarget& target, const Sprite& sprite,
-                            const sf::Vector2f& position, float rotation, float scale) {
-        if (!sprite.texture) {
-            // No texture - render colored rectangle
-            sf::RectangleShape rect(sprite.size);
-            rect.setOrigin(sprite.origin);
-            rect.setPosition(position);
-            rect.setRotation(rotation);
-            rect.setScale(scale, scale);
-            rect.setFillColor(sprite.color);
-            target.draw(rect);
-        } else {
-            // Render textured sprite
-            sf::Sprite sf_sprite(*sprite.texture, sprite.texture_rect);
-            sf_sprite.setOrigin(sprite.origin);
-            sf_sprite.setPosition(position);
-            sf_sprite.setRotation(rotation);
-            sf_sprite.setScale(scale, scale);
-            sf_sprite.setColor(sprite.color);
-            target.draw(sf_sprite);
-        }
-    }
-
     static void RenderAim(sf::RenderTarget& target, const sf::Vector2f& position,
                         const sf::Vector2f& mouse_position) {
 
@@ -0,0 +1,38 @@
+#ifndef ECS_SPATIAL_QUERY_SYSTEM_H
+#define ECS_SPATIAL_QUERY_SYSTEM_H
+
+#include "../world.h"
+
+namespace ecs {
+
+/**
+ * SpatialQuerySystem - Rebuilds the world's gameplay query index
+ * Run once per tick before anything that targets (AI, homing, chase movement),
+ * every enabled collider is indexed at its collider centre on its layer.
+ */
+class SpatialQuerySystem {
+public:
+    static void Update(World& world) {
+        auto& query = world.GetSpatialQuery();
+        query.Clear();
+
+        auto view = world.View<Transform, Collision>(entt::exclude<Inactive>);
+        query.Reserve(view.size_hint());
+
+        for (auto entity : view) {
+            const auto& collision = view.get<Collision>(entity);
+            if (!collision.enabled) {
+                continue;
+            }
+
+            const auto& transform = view.get<Transform>(entity);
+            query.Insert(entity, transform.position + collision.offset, collision.layer);
+        }
+
+        query.Build();
+    }
+};
+
+} // namespace ecs
+
+#endif // ECS_SPATIAL_QUERY_SYSTEM_H
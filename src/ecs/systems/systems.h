@@ -13,6 +13,9 @@
 #include "input_system.h"
 #include "movement_input_system.h"
 #include "bounds_system.h"
+#include "spatial_query_system.h"
+#include "ai_system.h"
+#include "homing_system.h"
 
 // Convenience header for including all ECS systems
 
@@ -17,6 +17,21 @@ struct BulletSpawnRequest {
     sf::Color color;
     sf::Vector2f size;
     entt::entity owner;  // Who fired this bullet
+    float homing_range{0.0f};  // Lock-on radius for homing bullets, 0 flies straight
+};
+
+/**
+ * BeamRequest - Data for firing an instant hit beam
+ */
+struct BeamRequest {
+    sf::Vector2f origin;
+    sf::Vector2f direction;  // Normalised
+    float range;
+    float damage;
+    sf::Color color;
+    float width;
+    float duration;  // How long the beam stays visible
+    entt::entity owner;  // Who fired this beam
 };
 
 /**
@@ -25,30 +40,25 @@ struct BulletSpawnRequest {
 class WeaponSystem {
 public:
     using BulletSpawnCallback = std::function<void(const BulletSpawnRequest&)>;
+    using BeamCallback = std::function<void(const BeamRequest&)>;
 
     // Update weapon cooldowns (single weapon - for enemies)
     static void Update(World& world, float dt) {
         // Update single Weapon components (enemies)
-        auto weapon_view = world.View<Weapon>();
-        for (auto entity : weapon_view) {
-            auto& weapon = weapon_view.get<Weapon>(entity);
-
+        world.ParallelEach<Weapon>([&](entt::entity, Weapon& weapon) {
             if (weapon.current_cooldown > 0.0f) {
                 weapon.current_cooldown -= dt;
                 if (weapon.current_cooldown < 0.0f) {
                     weapon.current_cooldown = 0.0f;
                 }
             }
-        }
+        });
 
         // Update Weapons components (multi-weapon - for players)
-        auto weapons_view = world.View<Weapons>();
-        for (auto entity : weapons_view) {
-            auto& weapons = weapons_view.get<Weapons>(entity);
-
+        world.ParallelEach<Weapons>([&](entt::entity, Weapons& weapons) {
             for (int i = 0; i < 4; ++i) {
-                if (weapons.slots[i].has_value()) {
-                    auto& weapon = *weapons.slots[i];
+                if (weapons.IsEquipped(i)) {
+                    auto& weapon = weapons.slots[i];
                     if (weapon.current_cooldown > 0.0f) {
                         weapon.current_cooldown -= dt;
                         if (weapon.current_cooldown < 0.0f) {
@@ -57,12 +67,13 @@ public:
                     }
                 }
             }
-        }
+        });
     }
 
     // Try to fire weapon, returns true if fired
     static bool TryFire(World& world, entt::entity entity,
-                       BulletSpawnCallback spawn_callback) {
+                       BulletSpawnCallback spawn_callback,
+                       BeamCallback beam_callback = nullptr) {
         if (!world.HasComponent<Weapon>(entity) ||
             !world.HasComponent<Transform>(entity)) {
             return false;
@@ -98,11 +109,11 @@ public:
                 break;
 
             case Weapon::Type::BEAM:
-                // TODO: Implement beam weapons
+                FireBeam(entity, transform, weapon, input, beam_callback);
                 break;
 
             case Weapon::Type::HOMING:
-                // TODO: Implement homing missiles
+                FireHoming(entity, transform, weapon, input, spawn_callback);
                 break;
         }
 
@@ -111,7 +122,8 @@ public:
 
     // Fire all active weapons on an entity
     static void FireAllWeapons(World& world, entt::entity entity,
-                              BulletSpawnCallback spawn_callback) {
+                              BulletSpawnCallback spawn_callback,
+                              BeamCallback beam_callback = nullptr) {
         // Check if entity has Weapons component (multi-weapon)
         if (world.HasComponent<Weapons>(entity)) {
             auto& weapons = world.GetComponent<Weapons>(entity);
@@ -122,8 +134,8 @@ public:
 
             // Fire each active weapon slot
             for (int i = 0; i < 4; ++i) {
-                if (weapons.slots[i].has_value()) {
-                    auto& weapon = *weapons.slots[i];
+                if (weapons.IsEquipped(i)) {
+                    auto& weapon = weapons.slots[i];
 
                     // Check if weapon can fire
                     if (weapon.active && weapon.current_cooldown <= 0.0f) {
@@ -145,11 +157,11 @@ public:
                                 break;
 
                             case Weapon::Type::BEAM:
-                                // TODO: Implement beam weapons
+                                FireBeam(entity, transform, weapon, input, beam_callback);
                                 break;
 
                             case Weapon::Type::HOMING:
-                                // TODO: Implement homing missiles
+                                FireHoming(entity, transform, weapon, input, spawn_callback);
                                 break;
                         }
                     }
@@ -158,7 +170,7 @@ public:
         }
         // Fallback to single Weapon component (for enemies)
         else if (world.HasComponent<Weapon>(entity)) {
-            TryFire(world, entity, spawn_callback);
+            TryFire(world, entity, spawn_callback, beam_callback);
         }
     }
 
@@ -214,6 +226,43 @@ private:
         spawn_callback(request);
     }
 
+    // Burst pattern (bullets_per_shot across spread_angle) where every bullet homes within weapon range
+    static void FireHoming(entt::entity owner, const Transform& transform,
+                           const Weapon& weapon, const Input* input,
+                           BulletSpawnCallback spawn_callback) {
+        FireBurst(owner, transform, weapon, input, [&](const BulletSpawnRequest& request) {
+            BulletSpawnRequest homing_request = request;
+            homing_request.homing_range = weapon.range;
+            spawn_callback(homing_request);
+        });
+    }
+
+    static void FireBeam(entt::entity owner, const Transform& transform,
+                         const Weapon& weapon, const Input* input,
+                         BeamCallback beam_callback) {
+        if (!beam_callback) {
+            return;
+        }
+
+        sf::Vector2f direction = ResolveDirection(transform, input);
+        float length = std::sqrt(direction.x * direction.x + direction.y * direction.y);
+        if (length < 0.001f) {
+            return;
+        }
+
+        BeamRequest request;
+        request.owner = owner;
+        request.origin = transform.position;
+        request.direction = direction / length;
+        request.range = weapon.range;
+        request.damage = weapon.damage;
+        request.color = weapon.bullet_color;
+        request.width = weapon.bullet_size.x;
+        request.duration = weapon.cooldown;  // Redrawn every shot while firing
+
+        beam_callback(request);
+    }
+
     static void FireBurst(entt::entity owner, const Transform& transform,
                          const Weapon& weapon, const Input* input,
                          BulletSpawnCallback spawn_callback) {
@@ -3,16 +3,36 @@
 
 #include <entt/entt.hpp>
 #include "components/components.h"
+#include "spatial/spatial_hash_grid.h"
+#include "spatial/narrow_phase_batch.h"
+#include "spatial/contact_cache.h"
+#include "spatial/spatial_query.h"
+#include "commands/command_buffer.h"
+#include "pool/entity_pool.h"
+#include "animation/animation_library.h"
+#include "render/render_queue.h"
+#include "render/sprite_batcher.h"
+#include "util/i_threaded_workload.h"
+#include <vector>
+#include <array>
+#include <tuple>
+#include <algorithm>
 
 namespace ecs {
 
+// Per chunk output of World::ParallelCollect, owned by the caller and reused every call
+template<typename T>
+using ChunkBuffers = std::vector<std::vector<T>>;
+
 /**
  * World - Main ECS registry wrapper
  * Manages all entities and components in the game
  */
 class World {
 public:
-    World() = default;
+    World() {
+        render_queue.Connect(registry);
+    }
     ~World() = default;
 
     // Non-copyable
@@ -28,6 +48,12 @@ public:
         registry.destroy(entity);
     }
 
+    // Batch creation, fills [first, last) with new entities in one pass
+    template<typename It>
+    void CreateEntities(It first, It last) {
+        registry.create(first, last);
+    }
+
     bool IsValid(entt::entity entity) const {
         return registry.valid(entity);
     }
@@ -44,6 +70,18 @@ public:
         }
     }
 
+    // Batch add, the same component value to every entity in [first, last)
+    template<typename Component, typename It>
+    void InsertComponents(It first, It last, const Component& component = {}) {
+        registry.insert<Component>(first, last, component);
+    }
+
+    // Batch add, one component per entity read from from
+    template<typename Component, typename It, typename ComponentIt>
+    void InsertComponentsFrom(It first, It last, ComponentIt from) {
+        registry.insert<Component>(first, last, from);
+    }
+
     template<typename Component>
     Component& GetComponent(entt::entity entity) {
         return registry.get<Component>(entity);
@@ -54,6 +92,18 @@ public:
         return registry.get<Component>(entity);
     }
 
+    // Overwrite a component and emit its update signal (Sprite layer / texture changes need this)
+    template<typename Component>
+    Component& ReplaceComponent(entt::entity entity, Component component) {
+        return registry.replace<Component>(entity, std::move(component));
+    }
+
+    // Edit a component in place and emit its update signal
+    template<typename Component, typename Fn>
+    Component& PatchComponent(entt::entity entity, Fn&& fn) {
+        return registry.patch<Component>(entity, std::forward<Fn>(fn));
+    }
+
     template<typename Component>
     bool HasComponent(entt::entity entity) const {
         return registry.all_of<Component>(entity);
@@ -80,13 +130,195 @@ public:
         return registry.view<Components...>();
     }
 
+    // View skipping entities that have any of the excluded components
+    template<typename... Components, typename... Exclude>
+    auto View(entt::exclude_t<Exclude...> exclude) {
+        return registry.view<Components...>(exclude);
+    }
+
+    /**
+     * Group owning the listed components, their arrays are packed and walked in
+     * lockstep. Get components are read through the group without being owned.
+     * A component can only be owned by one group, current owners:
+     *   Transform, Sprite - RenderSystem::Render (refreshes RenderQueue records)
+     *   Glow              - RenderSystem::RenderGlow
+     *   Movement          - MovementSystem::Update
+     *   Animation         - AnimationSystem::Update
+     * Groups owning nothing (Group<>(entt::get<...>)) just keep the matching
+     * entities packed and can be used freely.
+     */
+    template<typename... Owned, typename... Get, typename... Exclude>
+    auto Group(entt::get_t<Get...> get = entt::get_t<Get...>{},
+               entt::exclude_t<Exclude...> exclude = entt::exclude_t<Exclude...>{}) {
+        return registry.group<Owned...>(get, exclude);
+    }
+
+    // Entities per ParallelEach chunk, large enough that workers only meet at chunk edges
+    static constexpr size_t kParallelChunk = 1024;
+
+    // Workers for ParallelEach, without one every chunk runs on the calling thread
+    void SetWorkload(IThreadedWorkload* parallel_workload) { workload = parallel_workload; }
+
+    /**
+     * fn(entity, components...) for every entity of a group or single
+     * component view, split into contiguous chunks run on the workload.
+     * fn must only touch its own entity's components (reads of anything
+     * nobody writes are fine) and mustn't add, remove or destroy anything.
+     */
+    template<typename Source, typename Fn>
+    void ParallelEach(const Source& source, Fn&& fn, size_t chunk = kParallelChunk) {
+        auto first = source.begin();
+        ForEachChunk(source.size(), chunk, [&](size_t, size_t begin, size_t end) {
+            for (auto it = first + begin, last = first + end; it != last; ++it) {
+                auto entity = *it;
+                std::apply([&](auto&... components) { fn(entity, components...); }, source.get(entity));
+            }
+        });
+    }
+
+    // ParallelEach over entities with all of Components (a view for one, else a non-owning group)
+    template<typename... Components, typename Fn>
+    void ParallelEach(Fn&& fn, size_t chunk = kParallelChunk) {
+        if constexpr (sizeof...(Components) == 1) {
+            ParallelEach(registry.view<Components...>(), fn, chunk);
+        } else {
+            ParallelEach(registry.group<>(entt::get<Components...>), fn, chunk);
+        }
+    }
+
+    /**
+     * ParallelEach where fn(buffer, entity, components...) appends results
+     * to its chunk's buffer. Buffers are appended to out in chunk order, so
+     * out is the same as a single threaded walk would produce. The caller
+     * keeps chunk_buffers between calls so they hold on to their capacity.
+     */
+    template<typename T, typename Source, typename Fn>
+    void ParallelCollect(const Source& source, std::vector<T>& out, ChunkBuffers<T>& chunk_buffers,
+                         Fn&& fn, size_t chunk = kParallelChunk) {
+        size_t count = source.size();
+        size_t chunks = (count + chunk - 1) / chunk;
+        if (!workload || chunks <= 1) {
+            for (auto entity : source) {
+                std::apply([&](auto&... components) { fn(out, entity, components...); }, source.get(entity));
+            }
+            return;
+        }
+
+        if (chunk_buffers.size() < chunks) {
+            chunk_buffers.resize(chunks);
+        }
+        auto first = source.begin();
+        ForEachChunk(count, chunk, [&](size_t index, size_t begin, size_t end) {
+            auto& buffer = chunk_buffers[index];
+            buffer.clear();
+            for (auto it = first + begin, last = first + end; it != last; ++it) {
+                auto entity = *it;
+                std::apply([&](auto&... components) { fn(buffer, entity, components...); }, source.get(entity));
+            }
+        });
+
+        for (size_t index = 0; index < chunks; ++index) {
+            out.insert(out.end(), chunk_buffers[index].begin(), chunk_buffers[index].end());
+        }
+    }
+
     // Direct registry access for advanced use
     entt::registry& GetRegistry() { return registry; }
     const entt::registry& GetRegistry() const { return registry; }
 
+    // Broad phase grid and narrow phase batches, rebuilt by CollisionSystem each tick
+    SpatialHashGrid& GetSpatialGrid() { return spatial_grid; }
+    const SpatialHashGrid& GetSpatialGrid() const { return spatial_grid; }
+    NarrowPhaseBatch& GetNarrowPhase(size_t worker = 0) { return narrow_phases[worker]; }
+    size_t GetNarrowPhaseWorkerCount() const { return narrow_phases.size(); }
+
+    // Per worker read position while merging narrow phase hits, reset by each merge
+    std::vector<size_t>& GetNarrowPhaseCursors() { return narrow_phase_cursors; }
+
+    // Contacts carried between ticks for enter / stay / exit events
+    ContactCache& GetContactCache() { return contact_cache; }
+    const ContactCache& GetContactCache() const { return contact_cache; }
+
+    // Gameplay query index (radius / nearest / box), rebuilt by SpatialQuerySystem each tick
+    SpatialQuery& GetSpatialQuery() { return spatial_query; }
+    const SpatialQuery& GetSpatialQuery() const { return spatial_query; }
+
+    // Clip sets shared by every Animation component
+    AnimationLibrary& GetAnimationLibrary() { return animation_library; }
+    const AnimationLibrary& GetAnimationLibrary() const { return animation_library; }
+
+    // Sprites bucketed by (layer, texture), maintained from registry signals
+    RenderQueue& GetRenderQueue() { return render_queue; }
+    const RenderQueue& GetRenderQueue() const { return render_queue; }
+
+    // Turns each render queue bucket into one draw call
+    SpriteBatcher& GetSpriteBatcher() { return sprite_batcher; }
+    const SpriteBatcher& GetSpriteBatcher() const { return sprite_batcher; }
+
+    // Structural changes recorded while systems run, applied by FlushCommands
+    CommandBuffer& GetCommands() { return commands; }
+
+    // Sync point, call between systems or after a tick, never during an iteration
+    // Destroyed pooled entities are released back to their pool
+    void FlushCommands() {
+        recycled.clear();
+        commands.Playback(registry, [this](entt::entity entity) {
+            const auto* pooled = registry.try_get<Pooled>(entity);
+            if (!pooled) {
+                return false;
+            }
+            pools[pooled->pool].Release(registry, entity);
+            recycled.push_back(entity);
+            return true;
+        });
+
+        // A released entity comes back with the same id and version, its old contacts must not match
+        contact_cache.Forget(recycled);
+    }
+
+    // Build count inactive entities for a pool, build(entity) adds the archetype's components
+    template<typename Fn>
+    void ReservePool(PoolId id, size_t count, Fn&& build) {
+        auto& pool = pools[static_cast<size_t>(id)];
+        for (size_t i = 0; i < count; ++i) {
+            auto entity = registry.create();
+            build(entity);
+            pool.Add(registry, entity, id);
+        }
+    }
+
+    // Reactivate a pooled entity, entt::null when the pool is exhausted
+    entt::entity AcquirePooled(PoolId id) {
+        return pools[static_cast<size_t>(id)].Acquire(registry);
+    }
+
+    // Reactivate up to count pooled entities at once, appended to out
+    void AcquirePooled(PoolId id, size_t count, std::vector<entt::entity>& out) {
+        pools[static_cast<size_t>(id)].Acquire(registry, count, out);
+    }
+
+    const EntityPool& GetPool(PoolId id) const { return pools[static_cast<size_t>(id)]; }
+
+    // One narrow phase batch per collision worker, always at least one
+    void SetNarrowPhaseWorkerCount(size_t count) {
+        narrow_phases.resize(count > 0 ? count : 1);
+    }
+
     // Clear all entities
     void Clear() {
         registry.clear();
+        spatial_grid.Clear();
+        for (auto& narrow_phase : narrow_phases) {
+            narrow_phase.Clear();
+        }
+        contact_cache.Clear();
+        spatial_query.Clear();
+        commands.Clear();
+        for (auto& pool : pools) {
+            pool.Clear();
+        }
+        animation_library.Clear();
+        render_queue.Clear();
     }
 
     // Get entity count
@@ -95,7 +327,37 @@ public:
     }
 
 private:
+    // fn(chunk_index, begin, end) for each chunk of [0, count), on the workload when there's more than one
+    template<typename Fn>
+    void ForEachChunk(size_t count, size_t chunk, Fn&& fn) {
+        chunk = std::max<size_t>(chunk, 1);
+        size_t chunks = (count + chunk - 1) / chunk;
+        auto run = [&](size_t first_chunk, size_t last_chunk) {
+            for (size_t index = first_chunk; index < last_chunk; ++index) {
+                fn(index, index * chunk, std::min(count, (index + 1) * chunk));
+            }
+        };
+
+        if (!workload || chunks <= 1) {
+            run(0, chunks);
+            return;
+        }
+        workload->ParallelFor(chunks, 1, run);
+    }
+
     entt::registry registry;
+    IThreadedWorkload* workload{nullptr};
+    SpatialHashGrid spatial_grid;
+    std::vector<NarrowPhaseBatch> narrow_phases{1};
+    std::vector<size_t> narrow_phase_cursors;
+    ContactCache contact_cache;
+    SpatialQuery spatial_query;
+    CommandBuffer commands;
+    std::vector<entt::entity> recycled;  // Released by the last FlushCommands, sorted (playback order)
+    std::array<EntityPool, static_cast<size_t>(PoolId::COUNT)> pools;
+    AnimationLibrary animation_library;
+    RenderQueue render_queue;
+    SpriteBatcher sprite_batcher;
 };
 
 } // namespace ecs
@@ -30,7 +30,7 @@ Enemy::Enemy(
 				this->attributeComponent->TakeDamage(damage, position);
 				return this->attributeComponent->IsDead();
 			})
-			.SetPointTest([this](sf::Vector2f position, sf::Vector2f velocity, bool ray) -> std::shared_ptr<sf::Vector2f> {
+			.SetPointTest([this](sf::Vector2f position, sf::Vector2f velocity, bool ray) -> std::optional<sf::Vector2f> {
 				return this->DetectCollision(position, ray, velocity);
 			})
 			.SetZoneTest([this](sf::FloatRect& area) -> bool {
@@ -52,11 +52,18 @@ void Enemy::Update(const CollisionQuadTree& quadTree, float dt)
     };
 
 	const auto position = this->globalMovementComponent->Integrate(dt);
-	auto bounds = this->GetObject(EnemyObjects::ENEMY)->GetSprite()->getLocalBounds();
-	auto extent = sf::Vector2f(position.x + bounds.width, position.y + bounds.height);
+	auto size = this->GetObject(EnemyObjects::ENEMY)->GetSprite()->getGlobalBounds();
+	// Sprites have centred origins, so the box is centred on position
+	auto bounds = sf::FloatRect(position - sf::Vector2f(size.width, size.height) / 2.f, { size.width, size.height });
 
-	quadTree->Insert(std::make_shared<Point<CollisionMediators>>(position, this->GetTag(), this->mediators));
-	quadTree->Insert(std::make_shared<Point<CollisionMediators>>(extent, this->GetTag(), this->mediators));
+	if (this->quadTreeHandle == INVALID_QUAD_TREE_HANDLE)
+	{
+		this->quadTreeHandle = quadTree->Insert(Point<CollisionMediators>(bounds, this->GetTag(), this->mediators));
+	}
+	else
+	{
+		quadTree->Move(this->quadTreeHandle, bounds);
+	}
 
 	auto config = this->bulletConfigs.at(EnemyObjects::ENEMY);
 	Entity::Update({
@@ -70,6 +77,15 @@ void Enemy::Draw(const std::shared_ptr<IRenderer>& renderer, float interp) const
 	Entity::Draw(renderer, interpPosition);
 }
 
+void Enemy::Untrack(const CollisionQuadTree& quadTree)
+{
+	if (this->quadTreeHandle != INVALID_QUAD_TREE_HANDLE)
+	{
+		quadTree->Remove(this->quadTreeHandle);
+		this->quadTreeHandle = INVALID_QUAD_TREE_HANDLE;
+	}
+}
+
 void Enemy::InitBullets()
 {
     auto bulletMediators = BulletMediators()
@@ -24,10 +24,12 @@ public:
 	virtual ~Enemy() = default;
 	virtual void Update(const CollisionQuadTree& quadTree, float dt) override;
 	virtual void Draw(const std::shared_ptr<IRenderer>& renderer, float interp) const override;
+	virtual void Untrack(const CollisionQuadTree& quadTree) override;
 private:
 	void InitBullets();
 
 	std::shared_ptr<CollisionMediators> mediators;
+	QuadTreeHandle quadTreeHandle = INVALID_QUAD_TREE_HANDLE;
 };
 
 #endif //ENEMY_H
\ No newline at end of file
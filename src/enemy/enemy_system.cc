@@ -34,11 +34,16 @@ void EnemySystem::Update(const CollisionQuadTree& quadTree, float dt)
 	}
 
 	// Remove enemies
-    std::erase_if(enemies, [=](const std::shared_ptr<Entity<EnemyObjects>>& e) -> bool {
+    std::erase_if(enemies, [&](const std::shared_ptr<Entity<EnemyObjects>>& e) -> bool {
         auto enemySprite = e->GetObject(EnemyObjects::ENEMY)->GetSprite();
         auto enemyBounds = enemySprite->getGlobalBounds();
         auto enemyX = enemySprite->getPosition().x + enemyBounds.width;
-        return enemyX <= 0 || e->HasDied();
+        if (enemyX <= 0 || e->HasDied())
+        {
+            e->Untrack(quadTree);
+            return true;
+        }
+        return false;
     });
 
 	// Update all remaining enemies
@@ -4,6 +4,7 @@
 #include <SFML/Graphics.hpp>
 
 #include <memory>
+#include <optional>
 #include <vector>
 #include <functional>
 #include <unordered_map>
@@ -13,6 +14,7 @@
 #include "components/movement/i_global_movement_component.h"
 #include "components/attributes/i_attribute_component.h"
 #include "components/collision_detection/i_collision_detection_component.h"
+#include "util/i_ray_caster.h"
 #include "bullet/collision.h"
 #include "quad_tree/collision_quad_tree.h"
 
@@ -37,8 +39,10 @@ public:
 
 	virtual void Update(const CollisionQuadTree& quadTree, float dt) = 0;
 	virtual void Draw(const std::shared_ptr<IRenderer>& renderer, float interp) const = 0;
+	// Remove any points this entity tracks in the quad tree
+	virtual void Untrack(const CollisionQuadTree& quadTree) {}
 
-	[[nodiscard]] std::shared_ptr<sf::Vector2f> DetectCollision(const sf::Vector2f& origin, const bool ray = false, const sf::Vector2f& direction = sf::Vector2f()) const;
+	[[nodiscard]] std::optional<sf::Vector2f> DetectCollision(const sf::Vector2f& origin, const bool ray = false, const sf::Vector2f& direction = sf::Vector2f()) const;
 	[[nodiscard]] bool HasDied() const;
 	[[nodiscard]] std::string GetTag() const;
 
@@ -54,6 +58,9 @@ protected:
 	std::unordered_map<T, std::shared_ptr<BulletConfig>> bulletConfigs;
 
 	std::string tag;
+
+private:
+	mutable RayBoxBatch hitboxes; // Reused for ray tests against every object at once
 };
 
 template <typename T>
@@ -106,8 +113,18 @@ void Entity<T>::Draw(const std::shared_ptr<IRenderer>& renderer, sf::Vector2f in
 }
 
 template <typename T>
-std::shared_ptr<sf::Vector2f> Entity<T>::DetectCollision(const sf::Vector2f& origin, const bool ray, const sf::Vector2f& direction) const
+std::optional<sf::Vector2f> Entity<T>::DetectCollision(const sf::Vector2f& origin, const bool ray, const sf::Vector2f& direction) const
 {
+	if (ray)
+	{
+		this->hitboxes.Clear();
+		for (auto& o : objects)
+		{
+			this->hitboxes.Add(o.second->GetHitbox());
+		}
+		return this->collisionDetectionComponent->DetectRayCollision(this->hitboxes, origin, direction);
+	}
+
 	for (auto& o : objects)
 	{
 		auto collision = this->collisionDetectionComponent->DetectCollision(o.second->GetHitbox(), origin, ray, direction);
@@ -117,7 +134,7 @@ std::shared_ptr<sf::Vector2f> Entity<T>::DetectCollision(const sf::Vector2f& ori
 		}
 	}
 
-	return nullptr;
+	return std::nullopt;
 }
 
 template <typename T>
@@ -7,6 +7,7 @@
 #include "ui/fps.h"
 #include "ui/player_hud.h"
 #include "util/texture_atlas.h"
+#include "util/job_system.h"
 #include "renderer/glow_shader_renderer.h"
 #include "renderer/composite_renderer.h"
 
@@ -24,6 +25,9 @@ Game::Game()
 	this->InitFps();
 	this->InitTextureAtlas();
 
+	// One persistent worker pool shared by every parallel path
+	this->jobSystem = std::make_shared<JobSystem>();
+
 	this->InitGameStates();
 }
 
@@ -82,13 +86,14 @@ void Game::InitGameStates()
 
 	// Legacy play state
 	auto playState = std::make_shared<PlayState>(
-		std::make_unique<PlayStateBuilder>(this->bounds, this->textureAtlas)
+		std::make_unique<PlayStateBuilder>(this->bounds, this->textureAtlas, this->jobSystem)
     );
 
 	// NEW: ECS play state
 	auto ecsPlayState = std::make_shared<ECSPlayState>(
 		this->textureAtlas,
 		this->window,
+		this->jobSystem,
 		this->bounds
 	);
 
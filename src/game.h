@@ -11,6 +11,7 @@
 class Fps;
 class ITextureAtlas;
 class IRenderer;
+class IThreadedWorkload;
 
 template <typename T>
 class State;
@@ -37,6 +38,7 @@ private:
 	std::shared_ptr<IRenderer> renderer;
 	std::shared_ptr<Fps> fps;
 	std::shared_ptr<ITextureAtlas> textureAtlas;
+	std::shared_ptr<IThreadedWorkload> jobSystem;
 	std::shared_ptr<sf::Clock> clock;
 
 	std::shared_ptr<State<GameStates>> state;
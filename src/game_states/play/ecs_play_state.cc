@@ -1,6 +1,7 @@
 #include "ecs_play_state.h"
 #include "renderer/i_renderer.h"
 #include "util/texture_atlas.h"
+#include "util/i_threaded_workload.h"
 #include "util/random_number_mersenne_source.cc"
 #include <SFML/Graphics.hpp>
 #include <iostream>
@@ -8,13 +9,16 @@
 ECSPlayState::ECSPlayState(
     std::shared_ptr<ITextureAtlas> textureAtlas,
     std::shared_ptr<sf::RenderWindow> window,
+    std::shared_ptr<IThreadedWorkload> threadedWorkload,
     sf::FloatRect bounds
 )
     : textureAtlas(textureAtlas)
     , window(window)
+    , threadedWorkload(threadedWorkload)
     , bounds(bounds)
     , worldSpeed(100.0f)
     , player(entt::null)
+    , timingReportElapsed(0.0f)
 {
     // No legacy PlayerInput needed - pure ECS!
 }
@@ -36,6 +40,14 @@ void ECSPlayState::Setup() {
     const auto& constants = config.GetConstants();
     std::cout << "[ECS] Configuration loaded successfully" << std::endl;
 
+    // Size the collision broad phase grid and restrict it to the layer matrix
+    world.GetSpatialGrid().SetCellSize(constants.collision_cell_size);
+    world.GetSpatialGrid().SetLayerPairs(constants.collision_matrix);
+    world.GetSpatialQuery().SetCellSize(constants.query_cell_size);
+
+    // Per-entity systems split their iteration across the job system's workers
+    world.SetWorkload(threadedWorkload.get());
+
     // Initialize random number generator
 	auto seed = (unsigned int)std::chrono::system_clock::now().time_since_epoch().count();
 	auto randGenerator = std::make_unique<RandomNumberMersenneSource<int>>(seed);
@@ -45,6 +57,8 @@ void ECSPlayState::Setup() {
     std::cout.flush();
     factory = std::make_unique<ecs::EntityFactory>(world, config, std::move(randGenerator));
     factory->SetTextureAtlas(textureAtlas);  // Allows factory to load textures from config
+    factory->ReservePools();  // Bullets and particles are recycled, never created mid-game
+    factory->CompilePrefabs();  // Enemy types resolved once, spawns just copy them
     std::cout << "[ECS] Entity factory created" << std::endl;
 
     // Initialize scrolling background (Gradius-style!)
@@ -73,7 +87,7 @@ void ECSPlayState::Setup() {
     // Load spawn waves from enemies.toml
     std::cout << "[ECS] Loading spawn waves from config..." << std::endl;
     std::cout.flush();
-    if (ecs::EnemySpawnSystem::LoadSpawnWaves("config/enemies.toml")) {
+    if (ecs::EnemySpawnSystem::LoadSpawnWaves("config/enemies.toml", config)) {
         std::cout << "[ECS] Loaded " << ecs::EnemySpawnSystem::GetWaveCount()
                   << " spawn waves successfully" << std::endl;
     } else {
@@ -85,6 +99,10 @@ void ECSPlayState::Setup() {
     }
 
     std::cout << "[ECS] Enemy spawn system initialized" << std::endl;
+
+    // Declare system access and build the parallel schedule
+    RegisterSystems();
+
     std::cout << "[ECS] Total entities: " << world.GetEntityCount() << std::endl;
 }
 
@@ -100,81 +118,171 @@ void ECSPlayState::TearDown() {
     std::cout << "[ECS] World cleared" << std::endl;
 }
 
-void ECSPlayState::Update(float dt) {
+void ECSPlayState::RegisterSystems() {
     // === PURE ECS SYSTEM UPDATE ORDER ===
+    // Registration order is the sequential order, the scheduler overlaps
+    // systems whose declared component access doesn't conflict
+    scheduler.Clear();
 
-    // 1. Input System - Sample keyboard, update Input components
-    ecs::InputSystem::Update(world, *window);
+    // 1. Input System - Sample keyboard, update Input components (input devices stay on this thread)
+    scheduler.Add("Input", [this](float) {
+        ecs::InputSystem::Update(world, *window);
+    }).Exclusive();
 
     // 2. Movement Input System - Apply input to velocity/acceleration and select animations
-    ecs::MovementInputSystem::Update(world, config.GetConstants(), dt);  // Pass dt for physics!
+    scheduler.Add("MovementInput", [this](float dt) {
+        ecs::MovementInputSystem::Update(world, config.GetConstants(), dt);  // Pass dt for physics!
+    }).Reads<ecs::Input>().Writes<ecs::Transform, ecs::Physics, ecs::Animation>();
 
     // 3. Background System - Scrolling starfield (Gradius parallax!)
-    sf::Vector2f screen_size(bounds.width, bounds.height);
-    ecs::BackgroundSystem::Update(world, worldSpeed, dt, screen_size);
+    scheduler.Add("Background", [this](float dt) {
+        sf::Vector2f screen_size(bounds.width, bounds.height);
+        ecs::BackgroundSystem::Update(world, worldSpeed, dt, screen_size);
+    }).Reads<ecs::Background>().Writes<ecs::Transform>();
 
     // 3.5. Enemy Spawn System - Spawn enemies based on waves (NEW!)
-    ecs::EnemySpawnSystem::Update(world, dt, *factory, bounds, *textureAtlas);
+    scheduler.Add("EnemySpawn", [this](float dt) {
+        ecs::EnemySpawnSystem::Update(world, dt, *factory, bounds, *textureAtlas);
+    }).Exclusive();
+
+    // 3.6. Spatial Query System - Index collider positions once for all targeting below
+    scheduler.Add("SpatialQuery", [this](float) {
+        ecs::SpatialQuerySystem::Update(world);
+    }).Reads<ecs::Transform, ecs::Collision>().Writes<ecs::SpatialQuery>();
+
+    // 3.7. AI System - Acquire targets and pick chase / attack states
+    scheduler.Add("AI", [this](float dt) {
+        ecs::AISystem::Update(world, dt);
+    }).Reads<ecs::Transform, ecs::SpatialQuery>().Writes<ecs::AI>();
+
+    // 3.8. Homing System - Steer homing bullets toward their targets
+    scheduler.Add("Homing", [this](float dt) {
+        ecs::HomingSystem::Update(world, dt);
+    }).Reads<ecs::SpatialQuery>().Writes<ecs::Transform, ecs::Homing>();
 
     // 4. Movement System - Update positions for entities WITH Movement component (enemies!)
-    ecs::MovementSystem::Update(world, dt);
+    scheduler.Add("Movement", [this](float dt) {
+        ecs::MovementSystem::Update(world, dt);
+    }).Reads<ecs::AI, ecs::SpatialQuery>().Writes<ecs::Transform, ecs::Movement, ecs::Physics>();
 
     // 4.5. Movement System (Simple) - Update positions for entities WITHOUT Movement component (bullets, particles)
-    ecs::MovementSystem::UpdateSimple(world, dt);
+    scheduler.Add("MovementSimple", [this](float dt) {
+        ecs::MovementSystem::UpdateSimple(world, dt);
+    }).Reads<ecs::Movement>().Writes<ecs::Transform>();
 
     // 5. Bounds System - Clamp player to screen
-    ecs::BoundsSystem::ClampPlayer(world, bounds);
+    scheduler.Add("Bounds", [this](float) {
+        ecs::BoundsSystem::ClampPlayer(world, bounds);
+    }).Reads<ecs::PlayerTag>().Writes<ecs::Transform>();
+
+    // 5.5. Facing - Point sprites along their velocity (render-only rotation)
+    scheduler.Add("Facing", [this](float) {
+        ecs::MovementSystem::UpdateFacing(world);
+    }).Reads<ecs::Transform>().Writes<ecs::Sprite>();
 
     // 6. Animation System - Advance sprite frames (before rendering!)
-    ecs::AnimationSystem::Update(world, dt);
+    scheduler.Add("Animation", [this](float dt) {
+        ecs::AnimationSystem::Update(world, dt);
+    }).Writes<ecs::Animation, ecs::Sprite>();
 
     // 7. Weapon System - Update cooldowns
-    ecs::WeaponSystem::Update(world, dt);
-
-    // 8. Weapon slot toggling and firing for players
-    auto players = world.View<ecs::PlayerTag, ecs::Input, ecs::Weapons>();
-    for (auto entity : players) {
-        const auto& player_input = world.GetComponent<ecs::Input>(entity);
-        auto& weapons = world.GetComponent<ecs::Weapons>(entity);
-
-        // Sync weapon slot active states with input slot states
-        // Input component tracks which slots the player wants active (keys 1-4)
-        weapons.SetSlotActive(0, player_input.weapon_slot_1);
-        weapons.SetSlotActive(1, player_input.weapon_slot_2);
-        weapons.SetSlotActive(2, player_input.weapon_slot_3);
-        weapons.SetSlotActive(3, player_input.weapon_slot_4);
-
-        // Fire all active weapons if player presses fire (spacebar)
-        if (player_input.fire) {
-            ecs::WeaponSystem::FireAllWeapons(world, entity, [&](const ecs::BulletSpawnRequest& request) {
-                factory->CreateBullet(request, true, nullptr);
-            });
+    scheduler.Add("WeaponCooldowns", [this](float dt) {
+        ecs::WeaponSystem::Update(world, dt);
+    }).Writes<ecs::Weapon, ecs::Weapons>();
+
+    // 7.5. Health System - Regenerate shields after the damage delay
+    scheduler.Add("Health", [this](float dt) {
+        ecs::HealthSystem::Update(world, dt);
+    }).Writes<ecs::Health>();
+
+    // 8. Weapon slot toggling and firing for players (spawns bullets)
+    scheduler.Add("PlayerFire", [this](float) {
+        auto players = world.View<ecs::PlayerTag, ecs::Input, ecs::Weapons>();
+        for (auto entity : players) {
+            const auto& player_input = world.GetComponent<ecs::Input>(entity);
+            auto& weapons = world.GetComponent<ecs::Weapons>(entity);
+
+            // Sync weapon slot active states with input slot states
+            // Input component tracks which slots the player wants active (keys 1-4)
+            weapons.SetSlotActive(0, player_input.weapon_slot_1);
+            weapons.SetSlotActive(1, player_input.weapon_slot_2);
+            weapons.SetSlotActive(2, player_input.weapon_slot_3);
+            weapons.SetSlotActive(3, player_input.weapon_slot_4);
+
+            // Fire all active weapons if player presses fire (spacebar)
+            if (player_input.fire) {
+                ecs::WeaponSystem::FireAllWeapons(world, entity, [&](const ecs::BulletSpawnRequest& request) {
+                    factory->CreateBullet(request, true, nullptr);
+                }, [&](const ecs::BeamRequest& request) {
+                    FireBeam(request);
+                });
+            }
         }
-    }
-
-    // 4. Detect collisions
-    ecs::CollisionSystem::DetectCollisions(world, [&](auto a, auto b, auto pt) {
-        HandleCollision(a, b, pt);
-    });
+    }).Exclusive();
+
+    // 9. Detect collisions (split across workers when collision_threads > 1)
+    scheduler.Add("Collision", [this](float dt) {
+        auto collision_threads = static_cast<size_t>(std::max(config.GetConstants().collision_threads, 1));
+        ecs::CollisionSystem::UpdateContacts(world, dt, [&](ecs::ContactEvent event, const ecs::Contact& contact) {
+            HandleContact(event, contact);
+        }, *threadedWorkload, collision_threads);
+    }).Exclusive();
+
+    // 10. Cleanup dead entities
+    scheduler.Add("CleanupDead", [this](float) {
+        CleanupDeadEntities();
+    }).Exclusive();
+
+    // 11. Cleanup expired entities (bullets with lifetime)
+    scheduler.Add("CleanupExpired", [this](float dt) {
+        CleanupExpiredEntities(dt);
+    }).Exclusive();
+
+    scheduler.Build();
+    std::cout << "[ECS] Scheduled " << scheduler.GetTimings().size() << " systems in "
+              << scheduler.GetWaveCount() << " waves" << std::endl;
+}
 
-    // 5. Cleanup dead entities
-    CleanupDeadEntities();
+void ECSPlayState::Update(float dt) {
+    // 1-11. Run every system, independent ones in parallel on the workload
+    scheduler.Run(dt, *threadedWorkload);
 
-    // 6. Cleanup expired entities (bullets with lifetime)
-    CleanupExpiredEntities(dt);
+    // Apply the tick's queued creates / destroys in one batch
+    world.FlushCommands();
+    ReportSystemTimings(dt);
 
-    // 7. Check game over
+    // 12. Check game over
     if (PlayerDied()) {
         std::cout << "[ECS] Player died! Returning to menu..." << std::endl;
         this->Back();
     }
 
-    // 8. ESC to menu
+    // 13. ESC to menu
     if (sf::Keyboard::isKeyPressed(sf::Keyboard::Escape)) {
         this->Forward(GameStates::MENU);
     }
 }
 
+void ECSPlayState::ReportSystemTimings(float dt) {
+    if (!config.GetConstants().debug_show_system_timings) {
+        return;
+    }
+
+    // Once a second, the last tick's breakdown
+    timingReportElapsed += dt;
+    if (timingReportElapsed < 1.0f) {
+        return;
+    }
+    timingReportElapsed = 0.0f;
+
+    std::cout << "[ECS] Systems " << scheduler.GetTotalMilliseconds() << " ms" << std::endl;
+    for (const auto& timing : scheduler.GetTimings()) {
+        std::cout << "[ECS]   wave " << timing.wave << "  " << timing.name
+                  << "  " << timing.milliseconds << " ms" << std::endl;
+    }
+    std::cout << "[ECS] Sprite draw calls " << world.GetSpriteBatcher().GetDrawCalls() << std::endl;
+}
+
 void ECSPlayState::Draw(const std::shared_ptr<IRenderer>& renderer, float interp) const {
     // Render glow effects for bullets and explosions
     ecs::RenderSystem::RenderGlow(const_cast<ecs::World&>(world), *renderer, interp);
@@ -189,6 +297,36 @@ void ECSPlayState::Draw(const std::shared_ptr<IRenderer>& renderer, float interp
     }
 }
 
+void ECSPlayState::FireBeam(const ecs::BeamRequest& request) {
+    // One grid traversal against the colliders from the last collision pass
+    const auto& constants = config.GetConstants();
+    auto hit = world.GetSpatialGrid().RaycastFirst(
+        request.origin, request.direction, request.range, constants.layer_enemy);
+
+    float length = request.range;
+    if (hit && world.IsValid(hit->entity)) {
+        length = hit->distance;
+        ecs::HealthSystem::ApplyDamage(world, hit->entity, request.damage);
+        factory->CreateExplosion(hit->point, request.color, 4);
+    }
+
+    factory->CreateBeam(request.origin, request.direction, length, request.color, request.width, request.duration);
+}
+
+void ECSPlayState::HandleContact(ecs::ContactEvent event, const ecs::Contact& contact) {
+    // Earlier events this tick may already have queued either side for destruction
+    const auto& commands = world.GetCommands();
+    if (!world.IsValid(contact.entity_a) || !world.IsValid(contact.entity_b) ||
+        commands.IsDestroyQueued(contact.entity_a) || commands.IsDestroyQueued(contact.entity_b)) {
+        return;
+    }
+
+    // Hits apply once when the contact begins, not every tick of the overlap
+    if (event == ecs::ContactEvent::ENTER) {
+        HandleCollision(contact.entity_a, contact.entity_b, contact.point);
+    }
+}
+
 void ECSPlayState::HandleCollision(entt::entity a, entt::entity b, const sf::Vector2f& collision_point) {
     // Determine collision type and handle appropriately
     bool a_is_bullet = world.HasComponent<ecs::BulletTag>(a);
@@ -214,7 +352,7 @@ void ECSPlayState::HandleCollision(entt::entity a, entt::entity b, const sf::Vec
         factory->CreateExplosion(collision_point, sf::Color(255, 200, 0), 8);
 
         // Destroy bullet
-        world.DestroyEntity(a);
+        world.GetCommands().Destroy(a);
     }
     // Enemy hits player
     else if (a_is_enemy && b_is_player) {
@@ -225,7 +363,7 @@ void ECSPlayState::HandleCollision(entt::entity a, entt::entity b, const sf::Vec
         factory->CreateExplosion(collision_point, sf::Color(255, 0, 0), 8);
 
         // Destroy enemy (kamikaze)
-        world.DestroyEntity(a);
+        world.GetCommands().Destroy(a);
     }
     // Mirror cases
     else if (b_is_bullet && a_is_enemy) {
@@ -253,16 +391,16 @@ void ECSPlayState::CleanupDeadEntities() {
             factory->CreateExplosion(transform.position, sf::Color::Red, 16);
         }
 
-        // Destroy entity
-        world.DestroyEntity(entity);
+        // Destroy entity at the end of the tick
+        world.GetCommands().Destroy(entity);
     }
 }
 
 void ECSPlayState::CleanupExpiredEntities(float dt) {
-    auto expired = ecs::LifetimeSystem::Update(world, dt);
+    ecs::LifetimeSystem::Update(world, dt, expiredEntities, expiredChunks);
 
-    for (auto entity : expired) {
-        world.DestroyEntity(entity);
+    for (auto entity : expiredEntities) {
+        world.GetCommands().Destroy(entity);
     }
 }
 
@@ -12,6 +12,7 @@
 namespace sf { class RenderWindow; }
 
 class ITextureAtlas;
+class IThreadedWorkload;
 class IRenderer;
 class PlayerInput;
 
@@ -24,6 +25,7 @@ public:
     ECSPlayState(
         std::shared_ptr<ITextureAtlas> textureAtlas,
         std::shared_ptr<sf::RenderWindow> window,
+        std::shared_ptr<IThreadedWorkload> threadedWorkload,
         sf::FloatRect bounds
     );
     ~ECSPlayState() override = default;
@@ -40,17 +42,30 @@ private:
     ecs::World world;
     ecs::ConfigLoader config;
     std::unique_ptr<ecs::EntityFactory> factory;
+    ecs::SystemScheduler scheduler;
 
     // Game resources
     std::shared_ptr<ITextureAtlas> textureAtlas;
     std::shared_ptr<sf::RenderWindow> window;
+    std::shared_ptr<IThreadedWorkload> threadedWorkload;
     sf::FloatRect bounds;
     float worldSpeed;
 
     // Entities
     entt::entity player;
 
+    // Seconds since system timings were last printed
+    float timingReportElapsed;
+
+    // Expired lifetimes, reused every tick
+    std::vector<entt::entity> expiredEntities;
+    ecs::ChunkBuffers<entt::entity> expiredChunks;
+
     // Helper methods
+    void RegisterSystems();
+    void ReportSystemTimings(float dt);
+    void FireBeam(const ecs::BeamRequest& request);
+    void HandleContact(ecs::ContactEvent event, const ecs::Contact& contact);
     void HandleCollision(entt::entity a, entt::entity b, const sf::Vector2f& collision_point);
     void CleanupDeadEntities();
     void CleanupExpiredEntities(float dt);
@@ -45,13 +45,15 @@ void PlayState::TearDown()
 void PlayState::Update(float dt)
 {
 	auto in = this->input->SampleInput();
-	this->quadTree = builder->BuildQuadTree();
 
 	this->level->Update(worldSpeed, dt);
 	this->player->Update(this->quadTree, in, dt);
 	this->enemySystem->Update(this->quadTree, dt);
 	this->bulletSystem->Update(this->quadTree, dt, worldSpeed);
 
+	// Fold nodes emptied by this tick's moves and removals
+	this->quadTree->Prune();
+
 	if (this->player->HasDied())
 	{
 		this->Back();
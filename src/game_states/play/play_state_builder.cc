@@ -3,7 +3,7 @@
 #include <algorithm>
 
 #include "util/texture_atlas.h"
-#include "util/threaded_workload.h"
+#include "util/i_threaded_workload.h"
 #include "util/random_number_mersenne_source.cc"
 
 #include "level/space_level.h"
@@ -27,8 +27,8 @@
 #include "player/player_input.h"
 #include "components/weapon/burst/random_shot_weapon_component_factory.h"
 
-PlayStateBuilder::PlayStateBuilder(sf::FloatRect bounds, std::shared_ptr<ITextureAtlas> textureAtlas)
-  	: bounds(bounds), textureAtlas(textureAtlas)
+PlayStateBuilder::PlayStateBuilder(sf::FloatRect bounds, std::shared_ptr<ITextureAtlas> textureAtlas, std::shared_ptr<IThreadedWorkload> threadedWorkload)
+  	: bounds(bounds), textureAtlas(textureAtlas), threadedWorkload(threadedWorkload)
 {
 }
 
@@ -36,7 +36,7 @@ std::shared_ptr<SpaceLevel> PlayStateBuilder::BuildLevel() const
 {
 	auto seed = (unsigned int)std::chrono::system_clock::now().time_since_epoch().count();
 	auto randGenerator = std::make_shared<RandomNumberMersenneSource<int>>(seed);
-	return std::make_shared<SpaceLevel>(std::make_shared<ThreadedWorkload>(), randGenerator, sf::Vector2f(bounds.width, bounds.height));
+	return std::make_shared<SpaceLevel>(this->threadedWorkload, randGenerator, sf::Vector2f(bounds.width, bounds.height));
 }
 
 std::shared_ptr<IBulletSystem> PlayStateBuilder::BuildBulletSystem() const
@@ -163,5 +163,6 @@ std::shared_ptr<EnemySystem> PlayStateBuilder::BuildEnemySystem(std::shared_ptr<
 
 CollisionQuadTree PlayStateBuilder::BuildQuadTree() const
 {
-	return std::make_shared<QuadTree<Collision, CollisionMediators>>(bounds, 4);
+	// Loose tree so large ships straddling a split still sink below the root
+	return std::make_shared<QuadTree<Collision, CollisionMediators>>(bounds, 4, 8, 2.0f);
 }
\ No newline at end of file
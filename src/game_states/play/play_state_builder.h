@@ -8,10 +8,11 @@
 #include "i_play_state_builder.h"
 
 class ITextureAtlas;
+class IThreadedWorkload;
 
 class PlayStateBuilder : public IPlayStateBuilder {
 public:
-	PlayStateBuilder(sf::FloatRect bounds, std::shared_ptr<ITextureAtlas> textureAtlas);
+	PlayStateBuilder(sf::FloatRect bounds, std::shared_ptr<ITextureAtlas> textureAtlas, std::shared_ptr<IThreadedWorkload> threadedWorkload);
 	~PlayStateBuilder() override = default;
 
 	[[nodiscard]] std::shared_ptr<SpaceLevel> BuildLevel() const override;
@@ -25,6 +26,7 @@ public:
 private:
 	sf::FloatRect bounds;
 	std::shared_ptr<ITextureAtlas> textureAtlas;
+	std::shared_ptr<IThreadedWorkload> threadedWorkload;
 };
 
 #endif // PLAY_STATE_BUILDER
\ No newline at end of file
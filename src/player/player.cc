@@ -39,7 +39,7 @@ Player::Player(
 				this->attributeComponent->TakeDamage(damage, position);
 				return this->attributeComponent->IsDead();
 			})
-			.SetPointTest([this](sf::Vector2f position, sf::Vector2f velocity, bool ray) -> std::shared_ptr<sf::Vector2f> {
+			.SetPointTest([this](sf::Vector2f position, sf::Vector2f velocity, bool ray) -> std::optional<sf::Vector2f> {
 				return this->DetectCollision(position, ray, velocity);
 			})
 			.SetZoneTest([this](sf::FloatRect& area) -> bool {
@@ -59,11 +59,18 @@ void Player::Update(const CollisionQuadTree& quadTree, Input& in, float dt)
 	const auto position = this->movementComponent->Integrate(in, dt);
 	const auto direction = Player::CalculateDirection(position, lastPosition);
 
-	auto bounds = this->GetObject(PlayerObjects::SHIP)->GetSprite()->getLocalBounds();
-	auto extent = sf::Vector2f(position.x + bounds.width, position.y + bounds.height);
+	auto size = this->GetObject(PlayerObjects::SHIP)->GetSprite()->getGlobalBounds();
+	// Sprites have centred origins, so the box is centred on position
+	auto bounds = sf::FloatRect(position - sf::Vector2f(size.width, size.height) / 2.f, { size.width, size.height });
 
-	quadTree->Insert(std::make_shared<Point<CollisionMediators>>(position, this->GetTag(), this->mediators));
-	quadTree->Insert(std::make_shared<Point<CollisionMediators>>(extent, this->GetTag(), this->mediators));
+	if (this->quadTreeHandle == INVALID_QUAD_TREE_HANDLE)
+	{
+		this->quadTreeHandle = quadTree->Insert(Point<CollisionMediators>(bounds, this->GetTag(), this->mediators));
+	}
+	else
+	{
+		quadTree->Move(this->quadTreeHandle, bounds);
+	}
 
 	auto shipConfig = this->bulletConfigs.at(PlayerObjects::SHIP);
 	auto turrentConfig = this->bulletConfigs.at(PlayerObjects::TURRET);
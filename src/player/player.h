@@ -38,6 +38,7 @@ protected:
 	std::shared_ptr<IPlayerAttributeComponent> attributeComponent;
 
 	std::shared_ptr<CollisionMediators> mediators;
+	QuadTreeHandle quadTreeHandle = INVALID_QUAD_TREE_HANDLE;
 };
 
 #endif //PLAYER_H
\ No newline at end of file
@@ -2,6 +2,7 @@
 #define ANNATAR_COLLISION_QUAD_TREE_H
 
 #include <memory>
+#include <cstdint>
 
 struct Collision;
 struct CollisionMediators;
@@ -11,4 +12,8 @@ class QuadTree;
 
 using CollisionQuadTree = std::shared_ptr<QuadTree<Collision, CollisionMediators>>;
 
+// Stable handle to a point tracked by a QuadTree
+using QuadTreeHandle = uint32_t;
+constexpr QuadTreeHandle INVALID_QUAD_TREE_HANDLE = UINT32_MAX;
+
 #endif
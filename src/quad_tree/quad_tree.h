@@ -4,120 +4,548 @@
 #include <memory>
 #include <vector>
 #include <functional>
+#include <algorithm>
+#include <cstdint>
 
 #include <SFML/Graphics.hpp>
 #include "util/math_utils.h"
 #include "renderer/i_renderer.h"
 
 #include "shapes.h"
+#include "collision_quad_tree.h"
 #include "bullet/collision.h"
 
+// Persistent quad tree
+// Nodes and items live in pools that are reused between frames, items are
+// addressed by stable handles and moved in place. Nodes that become underfull
+// are only collapsed when Prune is called, so steady state frames don't allocate.
+//
+// Items are AABBs stored at the deepest node whose (loose) bounds fully contain
+// them. A looseness above 1 grows every node's bounds by that factor around its
+// centre, so objects straddling a split line still sink into a child instead of
+// piling up near the root. Queries test node loose bounds then each item's AABB.
 template <typename C, typename P>
 class QuadTree
 {
 public:
-	QuadTree(sf::FloatRect boundry, unsigned int capacity);
+	QuadTree(sf::FloatRect boundry, unsigned int capacity, unsigned int maxDepth = 8, float looseness = 1.0f);
 	virtual ~QuadTree() = default;
 
-	bool Insert(std::shared_ptr<Point<P>> point);
-	void Query(
-		ShapeQuery* range,
-		std::vector<std::shared_ptr<C>>& found,
-		std::function<std::shared_ptr<C>(std::shared_ptr<Point<P>>)> test) const;
+	QuadTreeHandle Insert(const Point<P>& point);
+	bool Move(QuadTreeHandle handle, const sf::FloatRect& bounds);
+	bool Move(QuadTreeHandle handle, sf::Vector2f position);
+	void Remove(QuadTreeHandle handle);
+	void Prune();
+	void Clear();
+
+	[[nodiscard]] bool IsValid(QuadTreeHandle handle) const;
+	[[nodiscard]] const Point<P>& Get(QuadTreeHandle handle) const;
+
+	// Call visitor(const Point<P>&) for each point whose bounds the range intersects
+	template <typename Range, typename Visitor>
+	void Visit(const Range& range, Visitor&& visitor) const;
+
+	// Push every engaged std::optional<C> returned by test(const Point<P>&) into found
+	// for points whose bounds the range intersects
+	template <typename Range, typename Sink, typename Test>
+	void Query(const Range& range, Sink& found, Test&& test) const;
+
 	void Draw(std::shared_ptr<IRenderer> renderer) const;
 
 private:
-	void Subdivide();
+	static constexpr uint32_t NONE = UINT32_MAX;
+
+	struct Node
+	{
+		sf::FloatRect boundry;
+		sf::FloatRect loose; // boundry scaled by looseness, what items must fit inside
+		uint32_t parent;
+		uint32_t children; // First of 4 contiguous children, NONE when leaf
+		uint32_t firstItem;
+		uint32_t count; // Items held directly by this node
+		uint32_t total; // Items held by this node and all descendants
+		unsigned int depth;
+		bool pendingCollapse;
+	};
+
+	struct Item
+	{
+		Point<P> point;
+		uint32_t node; // NONE when outside the boundry or free
+		uint32_t prev;
+		uint32_t next;
+		bool alive;
+	};
+
+	uint32_t AllocateChildren(uint32_t parent);
+	void Subdivide(uint32_t node);
+	uint32_t FittingQuadrant(uint32_t node, const sf::FloatRect& bounds) const;
+	sf::FloatRect Loosen(const sf::FloatRect& rect) const;
+	static sf::FloatRect Quadrant(const sf::FloatRect& rect, uint32_t quadrant);
+	static bool Contains(const sf::FloatRect& outer, const sf::FloatRect& inner);
+	static bool Overlaps(const sf::FloatRect& a, const sf::FloatRect& b);
+	bool Link(uint32_t item);
+	void Append(uint32_t node, uint32_t item);
+	void Unlink(uint32_t item);
+	void Collapse(uint32_t node);
+	void Gather(uint32_t node, uint32_t into);
+	void Release(uint32_t node);
+	template <typename Range, typename Visitor>
+	void VisitNode(uint32_t node, const Range& range, Visitor& visitor) const;
+	void Draw(uint32_t node, const std::shared_ptr<IRenderer>& renderer) const;
 
 private:
 	sf::FloatRect boundry;
 	unsigned int capacity;
+	unsigned int maxDepth;
+	float looseness;
 
-	std::vector<std::shared_ptr<Point<P>>> points;
+	std::vector<Node> nodes;
+	std::vector<uint32_t> freeNodes; // Free blocks of 4 children
 
-	std::unique_ptr<QuadTree<C, P>> nw;
-	std::unique_ptr<QuadTree<C, P>> ne;
-	std::unique_ptr<QuadTree<C, P>> se;
-	std::unique_ptr<QuadTree<C, P>> sw;
+	std::vector<Item> items;
+	std::vector<uint32_t> freeItems;
 
-	bool isDivided;
+	std::vector<uint32_t> pendingCollapse;
 };
 
 template <typename C, typename P>
-QuadTree<C, P>::QuadTree(sf::FloatRect boundry, unsigned int capacity)
+QuadTree<C, P>::QuadTree(sf::FloatRect boundry, unsigned int capacity, unsigned int maxDepth, float looseness)
 	: boundry(boundry),
 	capacity(capacity),
-	points({}),
-	nw(nullptr), ne(nullptr), se(nullptr), sw(nullptr),
-	isDivided(false)
+	maxDepth(maxDepth),
+	looseness(std::max(looseness, 1.0f))
+{
+	this->Clear();
+}
+
+template <typename C, typename P>
+void QuadTree<C, P>::Clear()
 {
+	this->nodes.clear();
+	this->freeNodes.clear();
+	this->items.clear();
+	this->freeItems.clear();
+	this->pendingCollapse.clear();
+
+	this->nodes.push_back({ this->boundry, this->Loosen(this->boundry), NONE, NONE, NONE, 0, 0, 0, false });
 }
 
 template <typename C, typename P>
-bool QuadTree<C, P>::Insert(std::shared_ptr<Point<P>> point)
+QuadTreeHandle QuadTree<C, P>::Insert(const Point<P>& point)
 {
-	if (!this->boundry.contains(point->position))
+	uint32_t handle;
+	if (!this->freeItems.empty())
 	{
-		return false;
+		handle = this->freeItems.back();
+		this->freeItems.pop_back();
+		this->items[handle] = { point, NONE, NONE, NONE, true };
 	}
+	else
+	{
+		handle = static_cast<uint32_t>(this->items.size());
+		this->items.push_back({ point, NONE, NONE, NONE, true });
+	}
+
+	// Points outside the boundry stay tracked so a later Move can bring them back in
+	this->Link(handle);
+	return handle;
+}
+
+template <typename C, typename P>
+bool QuadTree<C, P>::Move(QuadTreeHandle handle, const sf::FloatRect& bounds)
+{
+	auto& item = this->items[handle];
+	item.point.bounds = bounds;
+	item.point.position = sf::Vector2f(bounds.left + bounds.width / 2, bounds.top + bounds.height / 2);
 
-	if (this->points.size() < this->capacity)
+	// Still fits its node, nothing to restructure
+	if (item.node != NONE && Contains(this->nodes[item.node].loose, bounds))
 	{
-		this->points.push_back(point);
 		return true;
 	}
 
-	if (!this->isDivided)
+	if (item.node != NONE)
 	{
-		this->Subdivide();
+		this->Unlink(handle);
 	}
+	return this->Link(handle);
+}
 
-	return this->ne->Insert(point) || this->nw->Insert(point) ||
-		this->se->Insert(point) || this->sw->Insert(point);
+template <typename C, typename P>
+bool QuadTree<C, P>::Move(QuadTreeHandle handle, sf::Vector2f position)
+{
+	// Keep the extent, translate so the centre lands on position
+	auto bounds = this->items[handle].point.bounds;
+	bounds.left = position.x - bounds.width / 2;
+	bounds.top = position.y - bounds.height / 2;
+	return this->Move(handle, bounds);
 }
 
 template <typename C, typename P>
-void QuadTree<C, P>::Query(
-	ShapeQuery* range,
-	std::vector<std::shared_ptr<C>>& found,
-	std::function<std::shared_ptr<C>(std::shared_ptr<Point<P>>)> test) const
+void QuadTree<C, P>::Remove(QuadTreeHandle handle)
 {
-	if (!range->Intersects(this->boundry))
+	if (!this->IsValid(handle))
 	{
 		return;
 	}
 
-	for (auto& p : this->points)
+	if (this->items[handle].node != NONE)
 	{
-		auto output = test(p);
+		this->Unlink(handle);
+	}
+
+	auto& item = this->items[handle];
+	item.alive = false;
+	item.point.payload = nullptr;
+	this->freeItems.push_back(handle);
+}
+
+template <typename C, typename P>
+bool QuadTree<C, P>::IsValid(QuadTreeHandle handle) const
+{
+	return handle < this->items.size() && this->items[handle].alive;
+}
+
+template <typename C, typename P>
+const Point<P>& QuadTree<C, P>::Get(QuadTreeHandle handle) const
+{
+	return this->items[handle].point;
+}
+
+template <typename C, typename P>
+void QuadTree<C, P>::Prune()
+{
+	// Collapse shallowest first so descendants already folded into a parent are skipped
+	std::sort(this->pendingCollapse.begin(), this->pendingCollapse.end(), [this](uint32_t a, uint32_t b) {
+		return this->nodes[a].depth < this->nodes[b].depth;
+	});
+
+	for (auto node : this->pendingCollapse)
+	{
+		auto& n = this->nodes[node];
+		if (!n.pendingCollapse)
+		{
+			continue; // Released by an ancestor collapse
+		}
+		n.pendingCollapse = false;
+
+		if (n.children != NONE && n.total <= this->capacity)
+		{
+			this->Collapse(node);
+		}
+	}
+
+	this->pendingCollapse.clear();
+}
+
+template <typename C, typename P>
+bool QuadTree<C, P>::Link(uint32_t item)
+{
+	const auto bounds = this->items[item].point.bounds;
+	if (!Overlaps(this->nodes[0].loose, bounds))
+	{
+		return false;
+	}
+
+	// Items hanging over the edge stay at the root, which queries always visit
+	uint32_t node = 0;
+	while (true)
+	{
+		auto& n = this->nodes[node];
+		n.total++;
+
+		if (n.count < this->capacity || n.depth >= this->maxDepth)
+		{
+			this->Append(node, item);
+			return true;
+		}
+
+		auto quadrant = this->FittingQuadrant(node, bounds);
+		if (quadrant == NONE)
+		{
+			// Too big for any child
+			this->Append(node, item);
+			return true;
+		}
+
+		if (n.children == NONE)
+		{
+			this->Subdivide(node);
+		}
+
+		// Subdivide may have grown the pool, don't reuse n past this point
+		node = this->nodes[node].children + quadrant;
+	}
+}
+
+template <typename C, typename P>
+void QuadTree<C, P>::Append(uint32_t node, uint32_t item)
+{
+	auto& n = this->nodes[node];
+	auto& it = this->items[item];
+	it.node = node;
+	it.prev = NONE;
+	it.next = n.firstItem;
+	if (n.firstItem != NONE)
+	{
+		this->items[n.firstItem].prev = item;
+	}
+	n.firstItem = item;
+	n.count++;
+}
+
+template <typename C, typename P>
+void QuadTree<C, P>::Unlink(uint32_t item)
+{
+	auto& it = this->items[item];
+	auto& n = this->nodes[it.node];
+
+	if (it.prev != NONE)
+	{
+		this->items[it.prev].next = it.next;
+	}
+	else
+	{
+		n.firstItem = it.next;
+	}
+	if (it.next != NONE)
+	{
+		this->items[it.next].prev = it.prev;
+	}
+	n.count--;
+
+	// Walk up updating totals, flag nodes which can now fold their children
+	for (auto node = it.node; node != NONE; node = this->nodes[node].parent)
+	{
+		auto& current = this->nodes[node];
+		current.total--;
+		if (current.children != NONE && current.total <= this->capacity && !current.pendingCollapse)
+		{
+			current.pendingCollapse = true;
+			this->pendingCollapse.push_back(node);
+		}
+	}
+
+	it.node = NONE;
+	it.prev = NONE;
+	it.next = NONE;
+}
+
+template <typename C, typename P>
+uint32_t QuadTree<C, P>::AllocateChildren(uint32_t parent)
+{
+	if (!this->freeNodes.empty())
+	{
+		auto block = this->freeNodes.back();
+		this->freeNodes.pop_back();
+		return block;
+	}
+
+	auto block = static_cast<uint32_t>(this->nodes.size());
+	this->nodes.resize(this->nodes.size() + 4);
+	return block;
+}
+
+template <typename C, typename P>
+void QuadTree<C, P>::Subdivide(uint32_t node)
+{
+	auto block = this->AllocateChildren(node);
+
+	auto& n = this->nodes[node];
+	auto depth = n.depth + 1;
+
+	for (uint32_t c = 0; c < 4; c++)
+	{
+		auto quadrant = Quadrant(n.boundry, c);
+		this->nodes[block + c] = { quadrant, this->Loosen(quadrant), node, NONE, NONE, 0, 0, depth, false };
+	}
+	n.children = block;
+}
+
+template <typename C, typename P>
+sf::FloatRect QuadTree<C, P>::Quadrant(const sf::FloatRect& rect, uint32_t quadrant)
+{
+	auto w = rect.width / 2;
+	auto h = rect.height / 2;
+	auto x = rect.left + w;
+	auto y = rect.top + h;
+
+	// Same ne, nw, se, sw order as before
+	switch (quadrant)
+	{
+	case 0: return sf::FloatRect(x, y - h, w, h);
+	case 1: return sf::FloatRect(x - w, y - h, w, h);
+	case 2: return sf::FloatRect(x, y, w, h);
+	default: return sf::FloatRect(x - w, y, w, h);
+	}
+}
+
+template <typename C, typename P>
+sf::FloatRect QuadTree<C, P>::Loosen(const sf::FloatRect& rect) const
+{
+	auto marginX = rect.width * (this->looseness - 1.0f) / 2;
+	auto marginY = rect.height * (this->looseness - 1.0f) / 2;
+	return sf::FloatRect(rect.left - marginX, rect.top - marginY, rect.width + marginX * 2, rect.height + marginY * 2);
+}
+
+template <typename C, typename P>
+uint32_t QuadTree<C, P>::FittingQuadrant(uint32_t node, const sf::FloatRect& bounds) const
+{
+	// Only the child holding the centre can contain the whole box
+	const auto& rect = this->nodes[node].boundry;
+	auto east = bounds.left + bounds.width / 2 >= rect.left + rect.width / 2;
+	auto south = bounds.top + bounds.height / 2 >= rect.top + rect.height / 2;
+	uint32_t quadrant = south ? (east ? 2 : 3) : (east ? 0 : 1);
+
+	return Contains(this->Loosen(Quadrant(rect, quadrant)), bounds) ? quadrant : NONE;
+}
+
+template <typename C, typename P>
+bool QuadTree<C, P>::Contains(const sf::FloatRect& outer, const sf::FloatRect& inner)
+{
+	return inner.left >= outer.left && inner.top >= outer.top &&
+		inner.left + inner.width <= outer.left + outer.width &&
+		inner.top + inner.height <= outer.top + outer.height;
+}
+
+template <typename C, typename P>
+bool QuadTree<C, P>::Overlaps(const sf::FloatRect& a, const sf::FloatRect& b)
+{
+	return !(a.left > b.left + b.width || b.left > a.left + a.width ||
+		a.top > b.top + b.height || b.top > a.top + a.height);
+}
+
+template <typename C, typename P>
+void QuadTree<C, P>::Collapse(uint32_t node)
+{
+	auto children = this->nodes[node].children;
+	for (uint32_t c = 0; c < 4; c++)
+	{
+		this->Gather(children + c, node);
+		this->Release(children + c);
+	}
+
+	this->nodes[node].children = NONE;
+	this->freeNodes.push_back(children);
+}
+
+template <typename C, typename P>
+void QuadTree<C, P>::Gather(uint32_t node, uint32_t into)
+{
+	auto& n = this->nodes[node];
+
+	auto item = n.firstItem;
+	while (item != NONE)
+	{
+		auto next = this->items[item].next;
+		this->Append(into, item);
+		item = next;
+	}
+	n.firstItem = NONE;
+	n.count = 0;
+
+	if (n.children != NONE)
+	{
+		for (uint32_t c = 0; c < 4; c++)
+		{
+			this->Gather(n.children + c, into);
+		}
+	}
+}
+
+template <typename C, typename P>
+void QuadTree<C, P>::Release(uint32_t node)
+{
+	auto& n = this->nodes[node];
+	n.pendingCollapse = false;
+	n.total = 0;
+
+	if (n.children != NONE)
+	{
+		for (uint32_t c = 0; c < 4; c++)
+		{
+			this->Release(n.children + c);
+		}
+		this->freeNodes.push_back(n.children);
+		n.children = NONE;
+	}
+}
+
+template <typename C, typename P>
+template <typename Range, typename Visitor>
+void QuadTree<C, P>::Visit(const Range& range, Visitor&& visitor) const
+{
+	this->VisitNode(0, range, visitor);
+}
+
+template <typename C, typename P>
+template <typename Range, typename Sink, typename Test>
+void QuadTree<C, P>::Query(const Range& range, Sink& found, Test&& test) const
+{
+	this->Visit(range, [&found, &test](const Point<P>& point) {
+		auto output = test(point);
 		if (output) {
-			found.push_back(output);
+			found.push_back(std::move(*output));
+		}
+	});
+}
+
+template <typename C, typename P>
+template <typename Range, typename Visitor>
+void QuadTree<C, P>::VisitNode(uint32_t node, const Range& range, Visitor& visitor) const
+{
+	const auto& n = this->nodes[node];
+	if (n.total == 0)
+	{
+		return;
+	}
+
+	// The root also holds items overhanging the boundry, so it is always scanned
+	if (node != 0 && !range.Intersects(n.loose))
+	{
+		return;
+	}
+
+	for (auto item = n.firstItem; item != NONE; item = this->items[item].next)
+	{
+		const auto& point = this->items[item].point;
+		if (range.Intersects(point.bounds))
+		{
+			visitor(point);
 		}
 	}
 
-	if (this->isDivided)
+	if (n.children != NONE)
 	{
-		this->ne->Query(range, found, test);
-		this->nw->Query(range, found, test);
-		this->se->Query(range, found, test);
-		this->sw->Query(range, found, test);
+		for (uint32_t c = 0; c < 4; c++)
+		{
+			this->VisitNode(n.children + c, range, visitor);
+		}
 	}
 }
 
 template <typename C, typename P>
 void QuadTree<C, P>::Draw(std::shared_ptr<IRenderer> renderer) const
 {
-	if (this->isDivided)
+	this->Draw(0, renderer);
+}
+
+template <typename C, typename P>
+void QuadTree<C, P>::Draw(uint32_t node, const std::shared_ptr<IRenderer>& renderer) const
+{
+	const auto& n = this->nodes[node];
+	if (n.children != NONE)
 	{
-		this->nw->Draw(renderer);
-		this->ne->Draw(renderer);
-		this->sw->Draw(renderer);
-		this->se->Draw(renderer);
+		for (uint32_t c = 0; c < 4; c++)
+		{
+			this->Draw(n.children + c, renderer);
+		}
 	}
 
 	auto rectangle = sf::RectangleShape();
-	rectangle.setPosition(sf::Vector2f(this->boundry.left, this->boundry.top));
-	rectangle.setSize(sf::Vector2f(this->boundry.width, this->boundry.height));
+	rectangle.setPosition(sf::Vector2f(n.boundry.left, n.boundry.top));
+	rectangle.setSize(sf::Vector2f(n.boundry.width, n.boundry.height));
 	rectangle.setFillColor(sf::Color::Transparent);
 	rectangle.setOutlineColor(sf::Color::White);
 	rectangle.setOutlineThickness(-1.0f);
@@ -125,21 +553,4 @@ void QuadTree<C, P>::Draw(std::shared_ptr<IRenderer> renderer) const
 	renderer->GetDebugTarget().draw(rectangle);
 }
 
-template <typename C, typename P>
-void QuadTree<C, P>::Subdivide()
-{
-	auto w = this->boundry.width / 2;
-	auto h = this->boundry.height / 2;
-	auto x = this->boundry.left + w;
-	auto y = this->boundry.top + h;
-
-	this->ne = std::make_unique<QuadTree<C, P>>(sf::FloatRect(x, y - h, w, h), this->capacity);
-	this->nw = std::make_unique<QuadTree<C, P>>(sf::FloatRect(x - w, y - h, w, h), this->capacity);
-	this->se = std::make_unique<QuadTree<C, P>>(sf::FloatRect(x, y, w, h), this->capacity);
-	this->sw = std::make_unique<QuadTree<C, P>>(sf::FloatRect(x - w, y, w, h), this->capacity);
-
-	this->isDivided = true;
-}
-
 #endif // I_QUAD_TREE_H
-
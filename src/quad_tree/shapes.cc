@@ -9,7 +9,11 @@ RectangleQuery::RectangleQuery(sf::FloatRect rect)
 
 bool RectangleQuery::Intersects(sf::FloatRect range) const
 {
-	return range.intersects(this->rect);
+	// Inclusive so zero sized bounds (plain points) still register
+	return !(range.left > this->rect.left + this->rect.width ||
+		this->rect.left > range.left + range.width ||
+		range.top > this->rect.top + this->rect.height ||
+		this->rect.top > range.top + range.height);
 }
 
 sf::FloatRect RectangleQuery::Get() const
@@ -23,5 +27,5 @@ RayQuery::RayQuery(std::shared_ptr<IRayCaster> rayCaster, sf::Vector2f origin, s
 
 bool RayQuery::Intersects(sf::FloatRect range) const
 {
-	return this->rayCaster->RayBoxIntersects(origin, direction, range)->intersects;
+	return this->rayCaster->RayBoxIntersects(origin, direction, range).intersects;
 }
\ No newline at end of file
@@ -8,7 +8,8 @@
 
 template<typename P>
 struct Point {
-	sf::Vector2f position;
+	sf::Vector2f position; // Centre of bounds
+	sf::FloatRect bounds;
 	std::string tag;
 	std::shared_ptr<P> payload;
 
@@ -16,7 +17,14 @@ struct Point {
 		sf::Vector2f position,
 		std::string tag,
 		std::shared_ptr<P> payload)
-		: position(position), tag(tag), payload(payload)
+		: position(position), bounds(position, sf::Vector2f()), tag(tag), payload(payload)
+	{}
+
+	Point(
+		sf::FloatRect bounds,
+		std::string tag,
+		std::shared_ptr<P> payload)
+		: position(bounds.left + bounds.width / 2, bounds.top + bounds.height / 2), bounds(bounds), tag(tag), payload(payload)
 	{}
 };
 
@@ -29,7 +37,7 @@ public:
 	virtual bool Intersects(sf::FloatRect range) const = 0;
 };
 
-class RectangleQuery : public ShapeQuery
+class RectangleQuery final : public ShapeQuery
 {
 public:
 	RectangleQuery(sf::FloatRect rec);
@@ -43,7 +51,7 @@ private:
 };
 
 class IRayCaster;
-class RayQuery : public ShapeQuery
+class RayQuery final : public ShapeQuery
 {
 public:
 	RayQuery(std::shared_ptr<IRayCaster> rayCaster, sf::Vector2f origin, sf::Vector2f direction);
@@ -39,3 +39,8 @@ void CompositeRenderer::AddGlow(sf::Vector2f position, sf::Color color, float at
 {
 	this->glowRenderer->AddGlowAtPosition(position, color, attenuation);
 }
+
+void CompositeRenderer::FlushGlow() const
+{
+	this->glowRenderer->FlushGlow();
+}
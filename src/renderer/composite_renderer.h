@@ -22,6 +22,7 @@ public:
 	sf::RenderTexture& GetTarget() const override;
 	sf::RenderTexture& GetDebugTarget() const override;
 	void AddGlow(sf::Vector2f position, sf::Color color, float attenuation) override;
+	void FlushGlow() const override;
 
 private: 
 	mutable sf::RenderTexture windowTexture;
@@ -1,5 +1,8 @@
 #include "glow_shader_renderer.h"
 
+#include <algorithm>
+#include <cmath>
+
 static const std::string shaderCode = \
 "uniform vec2 frag_LightOrigin;"\
 "uniform vec3 frag_LightColor;"\
@@ -14,7 +17,19 @@ static const std::string shaderCode = \
 " vec4 lightColor = vec4(frag_LightColor,  clamp(frag_LightAttenuation, 0.0 ,frag_LightAttenuation));"\
 " vec4 color = vec4(attenuation, attenuation, attenuation, 1.0) * lightColor; gl_FragColor=color;}";
 
-GlowShaderRenderer::GlowShaderRenderer(sf::Vector2f bounds)
+// Same falloff as above, per vertex: tex coords are the offset from the light
+// already multiplied by its attenuation, colour is the light colour
+static const std::string quadShaderCode = \
+"void main(){"\
+" float linear_distance = length(gl_TexCoord[0].xy);"\
+" float attenuation = 1.0/(2.0*linear_distance);"\
+" gl_FragColor = vec4(gl_Color.rgb * 255.0 * attenuation, 1.0);}";
+
+// Contribution below which a light is cut off, one 8 bit colour step
+static const float glowCutoff = 1.0f / 255.0f;
+
+GlowShaderRenderer::GlowShaderRenderer(sf::Vector2f bounds, GlowMode mode)
+	: mode(mode), maxGlowRadius(std::sqrt(bounds.x * bounds.x + bounds.y * bounds.y)), glowQuads(sf::Triangles)
 {
 	this->windowTexture.create((int)bounds.x, (int)bounds.y);
     this->glowSprite.setTexture(this->windowTexture.getTexture());
@@ -23,6 +38,7 @@ GlowShaderRenderer::GlowShaderRenderer(sf::Vector2f bounds)
 
     this->shader.loadFromMemory(shaderCode, sf::Shader::Fragment);
     this->shader.setUniform("frag_ScreenResolution", bounds);
+    this->quadShader.loadFromMemory(quadShaderCode, sf::Shader::Fragment);
 }
 
 void GlowShaderRenderer::Clear(sf::Color color) const
@@ -32,6 +48,7 @@ void GlowShaderRenderer::Clear(sf::Color color) const
 
 void GlowShaderRenderer::Draw(sf::RenderTarget& window) const
 {
+    this->FlushGlow();
     this->windowTexture.display();
     window.draw(this->glowSprite);
 }
@@ -43,6 +60,12 @@ sf::RenderTexture& GlowShaderRenderer::ExposeTarget() const
 
 void GlowShaderRenderer::AddGlowAtPosition(sf::Vector2f position, sf::Color color, float attenuation)
 {
+    if (this->mode == GlowMode::QUADS)
+    {
+        this->AddGlowQuad(position, color, attenuation);
+        return;
+    }
+
     this->shader.setUniform("frag_LightOrigin", position);
     this->shader.setUniform("frag_LightColor", sf::Vector3f(color.r, color.g, color.b));
     this->shader.setUniform("frag_LightAttenuation", attenuation);
@@ -52,4 +75,45 @@ void GlowShaderRenderer::AddGlowAtPosition(sf::Vector2f position, sf::Color colo
     states.blendMode = sf::BlendAdd;
 
     this->windowTexture.draw(glowSprite, states);
-}
\ No newline at end of file
+}
+
+void GlowShaderRenderer::AddGlowQuad(sf::Vector2f position, sf::Color color, float attenuation)
+{
+    if (attenuation <= 0.0f)
+    {
+        return;
+    }
+
+    // Brightest channel * 1 / (2 * attenuation * distance) falls under the cutoff at this radius
+    float brightest = (float)std::max({ color.r, color.g, color.b });
+    float radius = std::min(brightest / (2.0f * attenuation * glowCutoff), this->maxGlowRadius);
+    if (radius <= 0.0f)
+    {
+        return;
+    }
+
+    sf::Color vertexColor(color.r, color.g, color.b, 255);
+    sf::Vector2f corners[4] = {
+        { -radius, -radius }, { radius, -radius }, { radius, radius }, { -radius, radius }
+    };
+
+    for (auto index : { 0, 1, 2, 0, 2, 3 })
+    {
+        this->glowQuads.append(sf::Vertex(position + corners[index], vertexColor, corners[index] * attenuation));
+    }
+}
+
+void GlowShaderRenderer::FlushGlow() const
+{
+    if (this->glowQuads.getVertexCount() == 0)
+    {
+        return;
+    }
+
+    sf::RenderStates states;
+    states.shader = &quadShader;
+    states.blendMode = sf::BlendAdd;
+
+    this->windowTexture.draw(this->glowQuads, states);
+    this->glowQuads.clear();
+}
@@ -8,19 +8,28 @@
 class GlowShaderRenderer: public IGlowShaderRenderer
 {
 public:
-	explicit GlowShaderRenderer(sf::Vector2f bounds);
+	explicit GlowShaderRenderer(sf::Vector2f bounds, GlowMode mode = GlowMode::QUADS);
 	~GlowShaderRenderer() override = default;
 	void Draw(sf::RenderTarget& window) const override;
 	sf::RenderTexture& ExposeTarget() const override;
 	void Clear(sf::Color color) const override;
 	void AddGlowAtPosition(sf::Vector2f position, sf::Color color, float attenuation) override;
+	void FlushGlow() const override;
 
 private:
+	void AddGlowQuad(sf::Vector2f position, sf::Color color, float attenuation);
+
+	GlowMode mode;
+	float maxGlowRadius;
 
 	sf::Shader shader;
+	sf::Shader quadShader;
 	mutable sf::RenderTexture windowTexture;
 	sf::Sprite glowSprite;
 
+	// Lights queued in QUADS mode, drawn by FlushGlow
+	mutable sf::VertexArray glowQuads;
+
 };
 
 #endif // GLOW_SHADER_RENDERER
\ No newline at end of file
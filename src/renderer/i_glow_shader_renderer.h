@@ -4,6 +4,13 @@
 
 #include <SFML/Graphics.hpp>
 
+// FULLSCREEN shades every pixel once per light, QUADS shades a bounded quad per light in one draw
+enum class GlowMode
+{
+	FULLSCREEN,
+	QUADS
+};
+
 class IGlowShaderRenderer
 {
 public:
@@ -13,6 +20,7 @@ public:
 	virtual sf::RenderTexture& ExposeTarget() const = 0;
 	virtual void Clear(sf::Color color) const = 0;
 	virtual void AddGlowAtPosition(sf::Vector2f position, sf::Color color, float attenuation) = 0;
+	virtual void FlushGlow() const = 0;
 };
 
 #endif // I_GLOW_SHADER_RENDERER
\ No newline at end of file
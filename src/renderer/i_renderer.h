@@ -17,6 +17,7 @@ public:
 	virtual sf::RenderTexture& GetDebugTarget() const = 0;
 
 	virtual void AddGlow(sf::Vector2f position, sf::Color color, float attenuation) = 0;
+	virtual void FlushGlow() const = 0;
 };
 
 #endif // I_RENDERER
\ No newline at end of file
@@ -4,28 +4,70 @@
 
 #include <SFML/Graphics.hpp>
 #include <memory>
+#include <vector>
 
 struct RayIntersection
 {
-	bool intersects;
+	bool intersects{false};
 	sf::Vector2f point;
+	float distance{0.0f}; // Along the ray, in multiples of its direction
 
-	explicit RayIntersection(bool intersects, sf::Vector2f point = sf::Vector2f())
-		: intersects(intersects), point(point)
+	RayIntersection() = default;
+	explicit RayIntersection(bool intersects, sf::Vector2f point = sf::Vector2f(), float distance = 0.0f)
+		: intersects(intersects), point(point), distance(distance)
 	{}
 };
 
+// Boxes stored as structure of arrays so one ray can be tested against many
+struct RayBoxBatch
+{
+	std::vector<float> left;
+	std::vector<float> top;
+	std::vector<float> right;
+	std::vector<float> bottom;
+
+	void Add(const sf::FloatRect& box)
+	{
+		left.push_back(box.left);
+		top.push_back(box.top);
+		right.push_back(box.left + box.width);
+		bottom.push_back(box.top + box.height);
+	}
+
+	void Clear()
+	{
+		left.clear();
+		top.clear();
+		right.clear();
+		bottom.clear();
+	}
+
+	size_t Size() const
+	{
+		return left.size();
+	}
+};
+
 class IRayCaster
 {
 public:
 	IRayCaster() = default;
 	virtual ~IRayCaster() = default;
 
-	[[nodiscard]] virtual std::shared_ptr<RayIntersection> RayBoxIntersects(
+	// Entry point of the ray into the box, or the exit point when the origin is inside
+	[[nodiscard]] virtual RayIntersection RayBoxIntersects(
         const sf::Vector2f& origin,
         const sf::Vector2f& direction,
         sf::FloatRect box
     ) const = 0;
+
+	// One ray against every box in the batch, intersections[i] is for box i
+	virtual void RayBoxIntersects(
+        const sf::Vector2f& origin,
+        const sf::Vector2f& direction,
+        const RayBoxBatch& boxes,
+        std::vector<RayIntersection>& intersections
+    ) const = 0;
 };
 
-#endif // I_RAY_CASTER_H
\ No newline at end of file
+#endif // I_RAY_CASTER_H
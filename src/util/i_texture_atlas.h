@@ -4,6 +4,11 @@
 
 #include <SFML/Graphics.hpp>
 #include <memory>
+#include <string>
+#include <cstdint>
+
+// Dense index of a texture in the atlas, resolved from its tag once at load time
+enum class TextureHandle : uint16_t { INVALID = 0xFFFF };
 
 class ITextureAtlas: public std::enable_shared_from_this<ITextureAtlas>
 {
@@ -12,6 +17,8 @@ public:
 	virtual ~ITextureAtlas() = default;
 	virtual std::shared_ptr<ITextureAtlas> AddTexture(const std::string& tag, const std::string& texturePath) = 0;
 	virtual std::shared_ptr<sf::Texture> GetTexture(const std::string& tag) const = 0;
+	virtual TextureHandle FindTexture(const std::string& tag) const = 0;
+	virtual sf::Texture* Resolve(TextureHandle handle) const = 0;
 };
 
 #endif // I_TEXTURE_ATLAS
\ No newline at end of file
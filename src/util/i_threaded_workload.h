@@ -13,6 +13,8 @@ public:
 	virtual ~IThreadedWorkload() = default;
 	virtual std::shared_ptr<IThreadedWorkload> AddTask(std::function<void(void)> task) = 0;
 	virtual void Join() = 0;
+	// body(begin, end) over [0, count) in chunks of grain (0 picks one), returns when every chunk is done
+	virtual void ParallelFor(size_t count, size_t grain, const std::function<void(size_t, size_t)>& body) = 0;
 };
 
 #endif // I_THREADED_WORKLOAD_H
\ No newline at end of file
@@ -0,0 +1,235 @@
+#include "job_system.h"
+
+#include <algorithm>
+
+thread_local const JobSystem* JobSystem::currentSystem = nullptr;
+thread_local size_t JobSystem::currentWorker = 0;
+
+JobSystem::JobSystem(size_t workerCount)
+{
+	if (workerCount == 0)
+	{
+		auto hardware = (size_t)std::thread::hardware_concurrency();
+		workerCount = std::max<size_t>(hardware, 2) - 1;
+	}
+
+	for (size_t i = 0; i <= workerCount; i++)
+	{
+		this->queues.push_back(std::make_unique<Queue>());
+		this->joinCounters.push_back(std::make_unique<Counter>());
+	}
+
+	this->workers.reserve(workerCount);
+	for (size_t i = 0; i < workerCount; i++)
+	{
+		this->workers.emplace_back([this, i]() { this->WorkerLoop(i); });
+	}
+}
+
+JobSystem::~JobSystem()
+{
+	{
+		std::lock_guard<std::mutex> lock(this->sleepMutex);
+		this->stopping = true;
+	}
+	this->wake.notify_all();
+
+	for (auto& worker : this->workers)
+	{
+		worker.join();
+	}
+}
+
+std::shared_ptr<IThreadedWorkload> JobSystem::AddTask(Job task)
+{
+	this->Run(std::move(task), *this->joinCounters[this->CurrentQueue()]);
+	return shared_from_this();
+}
+
+void JobSystem::Join()
+{
+	this->Wait(*this->joinCounters[this->CurrentQueue()]);
+}
+
+void JobSystem::Run(Job job, Counter& counter)
+{
+	counter.pending.fetch_add(1, std::memory_order_relaxed);
+	this->Push(std::move(job), &counter);
+}
+
+void JobSystem::Run(Job job, Counter& counter, Counter& dependency)
+{
+	counter.pending.fetch_add(1, std::memory_order_relaxed);
+	{
+		// Finish takes the continuations under this lock once pending hits zero,
+		// so a job is either parked here before that or queued straight away
+		std::lock_guard<std::mutex> lock(dependency.mutex);
+		if (!dependency.Done())
+		{
+			dependency.continuations.emplace_back(std::move(job), &counter);
+			return;
+		}
+	}
+	this->Push(std::move(job), &counter);
+}
+
+void JobSystem::Wait(Counter& counter)
+{
+	auto index = this->CurrentQueue();
+	while (!counter.Done())
+	{
+		if (!this->TryRunOne(index))
+		{
+			std::this_thread::yield();
+		}
+	}
+
+	// The last job may still be releasing the lock, the counter is only free after that
+	std::lock_guard<std::mutex> lock(counter.mutex);
+}
+
+void JobSystem::ParallelFor(size_t count, size_t grain, const std::function<void(size_t, size_t)>& body)
+{
+	if (count == 0)
+	{
+		return;
+	}
+
+	// A few chunks per thread so stealing can even out uneven chunks
+	if (grain == 0)
+	{
+		auto threads = this->workers.size() + 1;
+		grain = std::max<size_t>(1, count / (threads * 4));
+	}
+
+	if (grain >= count)
+	{
+		body(0, count);
+		return;
+	}
+
+	Counter counter;
+	for (size_t begin = grain; begin < count; begin += grain)
+	{
+		auto end = std::min(count, begin + grain);
+		this->Run([&body, begin, end]() { body(begin, end); }, counter);
+	}
+
+	// First chunk runs here while the rest are picked up
+	body(0, grain);
+	this->Wait(counter);
+}
+
+size_t JobSystem::GetWorkerCount() const
+{
+	return this->workers.size();
+}
+
+void JobSystem::WorkerLoop(size_t index)
+{
+	currentSystem = this;
+	currentWorker = index;
+
+	while (true)
+	{
+		if (this->TryRunOne(index))
+		{
+			continue;
+		}
+
+		std::unique_lock<std::mutex> lock(this->sleepMutex);
+		this->wake.wait(lock, [this]() { return this->stopping || this->queued.load() > 0; });
+		if (this->stopping)
+		{
+			return;
+		}
+	}
+}
+
+void JobSystem::Push(Job job, Counter* counter)
+{
+	auto& queue = *this->queues[this->CurrentQueue()];
+	{
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		queue.jobs.emplace_back(std::move(job), counter);
+	}
+	this->queued.fetch_add(1);
+
+	// Taking the lock orders this push against a worker checking queued before it sleeps
+	{
+		std::lock_guard<std::mutex> lock(this->sleepMutex);
+	}
+	this->wake.notify_one();
+}
+
+bool JobSystem::TryRunOne(size_t index)
+{
+	std::pair<Job, Counter*> job;
+	bool found = false;
+
+	// Own queue newest first, then steal oldest first from the others
+	for (size_t offset = 0; offset < this->queues.size() && !found; offset++)
+	{
+		auto& queue = *this->queues[(index + offset) % this->queues.size()];
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		if (queue.jobs.empty())
+		{
+			continue;
+		}
+
+		if (offset == 0)
+		{
+			job = std::move(queue.jobs.back());
+			queue.jobs.pop_back();
+		}
+		else
+		{
+			job = std::move(queue.jobs.front());
+			queue.jobs.pop_front();
+		}
+		found = true;
+	}
+
+	if (!found)
+	{
+		return false;
+	}
+
+	this->queued.fetch_sub(1);
+	job.first();
+	this->Finish(job.second);
+	return true;
+}
+
+void JobSystem::Finish(Counter* counter)
+{
+	// Only the last job out needs the lock, everyone else just counts down
+	auto pending = counter->pending.load(std::memory_order_relaxed);
+	while (pending > 1)
+	{
+		if (counter->pending.compare_exchange_weak(pending, pending - 1, std::memory_order_acq_rel))
+		{
+			return;
+		}
+	}
+
+	// Hitting zero under the lock keeps Run from parking a job after the
+	// continuations were taken, and lets Wait know when the counter is free
+	std::vector<std::pair<Job, Counter*>> continuations;
+	{
+		std::lock_guard<std::mutex> lock(counter->mutex);
+		if (counter->pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		{
+			continuations.swap(counter->continuations);
+		}
+	}
+	for (auto& [job, next] : continuations)
+	{
+		this->Push(std::move(job), next);
+	}
+}
+
+size_t JobSystem::CurrentQueue() const
+{
+	return currentSystem == this ? currentWorker : this->queues.size() - 1;
+}
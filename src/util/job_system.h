@@ -0,0 +1,90 @@
+#ifndef JOB_SYSTEM_H
+#define JOB_SYSTEM_H
+
+
+#include "i_threaded_workload.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Persistent worker pool with per worker deques and work stealing.
+// Workers pop their own deque from the back and steal from the front of
+// others. Threads outside the pool share one extra deque, and any thread
+// waiting on a counter runs queued jobs instead of blocking.
+class JobSystem : public IThreadedWorkload
+{
+public:
+	using Job = std::function<void(void)>;
+
+	// Outstanding job count, jobs can be made to start once a counter is done.
+	// Must outlive every job that signals or depends on it
+	class Counter
+	{
+	public:
+		Counter() = default;
+		Counter(const Counter&) = delete;
+		Counter& operator=(const Counter&) = delete;
+
+		[[nodiscard]] bool Done() const { return pending.load(std::memory_order_acquire) == 0; }
+
+	private:
+		friend class JobSystem;
+
+		std::atomic<size_t> pending{ 0 };
+		std::mutex mutex;
+		std::vector<std::pair<Job, Counter*>> continuations;
+	};
+
+	// Zero workers picks one per hardware thread, less the calling thread
+	explicit JobSystem(size_t workerCount = 0);
+	~JobSystem() override;
+
+	// Tasks added since the last Join share a counter, one per worker and one for threads outside the pool
+	std::shared_ptr<IThreadedWorkload> AddTask(Job task) override;
+	void Join() override;
+
+	// Queue job, counter is signalled when it finishes
+	void Run(Job job, Counter& counter);
+	// Queue job once dependency is done
+	void Run(Job job, Counter& counter, Counter& dependency);
+	// Runs queued jobs on this thread until counter is done
+	void Wait(Counter& counter);
+
+	void ParallelFor(size_t count, size_t grain, const std::function<void(size_t, size_t)>& body) override;
+
+	[[nodiscard]] size_t GetWorkerCount() const;
+
+private:
+	struct Queue
+	{
+		std::mutex mutex;
+		std::deque<std::pair<Job, Counter*>> jobs;
+	};
+
+	void WorkerLoop(size_t index);
+	void Push(Job job, Counter* counter);
+	bool TryRunOne(size_t index);
+	void Finish(Counter* counter);
+	[[nodiscard]] size_t CurrentQueue() const;
+
+	std::vector<std::thread> workers;
+	// One per worker plus one shared by threads outside the pool (last)
+	std::vector<std::unique_ptr<Queue>> queues;
+	std::vector<std::unique_ptr<Counter>> joinCounters;
+
+	std::atomic<size_t> queued{ 0 };
+	std::atomic<bool> stopping{ false };
+	std::mutex sleepMutex;
+	std::condition_variable wake;
+
+	static thread_local const JobSystem* currentSystem;
+	static thread_local size_t currentWorker;
+};
+
+#endif // JOB_SYSTEM_H
@@ -1,94 +1,104 @@
 #include "ray_caster.h"
 
-#include <range/v3/algorithm.hpp>
+#include <algorithm>
+#include <limits>
 
-#include "util/math_utils.h"
+namespace
+{
+	// Inverse direction, zero components are flagged rather than relied on as +-infinity
+	struct InverseRay
+	{
+		float x;
+		float y;
+		bool zeroX;
+		bool zeroY;
+
+		explicit InverseRay(const sf::Vector2f& direction)
+			: x(direction.x != 0.0f ? 1.0f / direction.x : 0.0f),
+			  y(direction.y != 0.0f ? 1.0f / direction.y : 0.0f),
+			  zeroX(direction.x == 0.0f),
+			  zeroY(direction.y == 0.0f)
+		{}
+	};
+
+	// Clip [tNear, tFar] to one axis' slab. A ray parallel to the slab is inside it
+	// for every t or never, so it is decided by the origin instead of 0 * inf = NaN
+	inline bool ClipSlab(float origin, float inverse, bool zero, float low, float high, float& tNear, float& tFar)
+	{
+		if (zero)
+		{
+			return origin >= low && origin <= high;
+		}
+
+		auto t1 = (low - origin) * inverse;
+		auto t2 = (high - origin) * inverse;
+		tNear = std::max(tNear, std::min(t1, t2));
+		tFar = std::min(tFar, std::max(t1, t2));
+		return true;
+	}
+
+	// Slab method, see https://tavianator.com/2011/ray_box.html for details
+	inline bool SlabTest(
+        const sf::Vector2f& origin,
+        const InverseRay& inverse,
+        float left, float top, float right, float bottom,
+        float& distance)
+	{
+		distance = 0.0f;
+		if (inverse.zeroX && inverse.zeroY)
+		{
+			return false;
+		}
+
+		auto tNear = -std::numeric_limits<float>::infinity();
+		auto tFar = std::numeric_limits<float>::infinity();
+		if (!ClipSlab(origin.x, inverse.x, inverse.zeroX, left, right, tNear, tFar) ||
+			!ClipSlab(origin.y, inverse.y, inverse.zeroY, top, bottom, tNear, tFar))
+		{
+			return false;
+		}
 
-using Line = std::pair<sf::Vector2f, sf::Vector2f>;
+		// Entry point when starting outside, exit point when starting inside
+		distance = tNear > 0.0f ? tNear : tFar;
+		return tFar > 0.0f && tFar >= tNear;
+	}
+}
 
-// See https://en.wikipedia.org/wiki/Line%E2%80%93line_intersection for details
-std::shared_ptr<RayIntersection> RayCaster::RayBoxIntersects(
+RayIntersection RayCaster::RayBoxIntersects(
     const sf::Vector2f& origin,
     const sf::Vector2f& direction,
     sf::FloatRect box
 ) const
 {
-	auto top = box.top;
-	auto bottom = box.top + box.height;
-	auto left = box.left;
-	auto right = box.left + box.width;
-
-	// Here I define each line of the hitbox
-    std::vector<Line> lines {
-        { // left
-            sf::Vector2f(left, top),
-            sf::Vector2f(left, bottom)
-        },
-        { // bottom
-            sf::Vector2f(left, bottom),
-            sf::Vector2f(right, bottom)
-        },
-        { // right
-            sf::Vector2f(right, bottom),
-            sf::Vector2f(right, top)
-        },
-        { // top
-            sf::Vector2f(right, top),
-            sf::Vector2f(left, top)
-        }
-    };
-
-	ranges::sort(lines,
-        [&origin](const auto& lineA, const auto& lineB) -> bool {
-            sf::Vector2f centerA {
-                (lineA.first.x + lineA.second.x) / 2,
-                (lineA.first.y + lineA.second.y) / 2
-            };
-
-            sf::Vector2f centerB {
-                (lineB.first.x + lineB.second.x) / 2,
-                (lineB.first.y + lineB.second.y) / 2
-            };
+	InverseRay inverse(direction);
 
-            // Here I want to be able to measure distance between the origin and the center of each line
-            auto distanceA = Dimensions::ManhattanDistance(centerA, origin);
-            auto distanceB = Dimensions::ManhattanDistance(centerB, origin);
+	float distance;
+	if (!SlabTest(origin, inverse, box.left, box.top, box.left + box.width, box.top + box.height, distance))
+	{
+		return RayIntersection(false);
+	}
 
-            return distanceA < distanceB;
-        });
+	return RayIntersection(true, origin + direction * distance, distance);
+}
 
-	// Define ray
-	auto x3 = origin.x;
-	auto y3 = origin.y;
-	auto x4 = origin.x + direction.x;
-	auto y4 = origin.y + direction.y;
+void RayCaster::RayBoxIntersects(
+    const sf::Vector2f& origin,
+    const sf::Vector2f& direction,
+    const RayBoxBatch& boxes,
+    std::vector<RayIntersection>& intersections
+) const
+{
+	InverseRay inverse(direction);
 
-	for (auto& line : lines)
+	intersections.resize(boxes.Size());
+	for (size_t i = 0; i < boxes.Size(); i++)
 	{
-		auto x1 = line.first.x;
-		auto y1 = line.first.y;
-		auto x2 = line.second.x;
-		auto y2 = line.second.y;
-
-		auto den = (x1 - x2) * (y3 - y4) - (y1 - y2) * (x3 - x4);
-		if (den == 0)
-        {
-			continue;
-		}
+		float distance;
+		auto hit = SlabTest(origin, inverse, boxes.left[i], boxes.top[i], boxes.right[i], boxes.bottom[i], distance);
 
-		auto t = ((x1 - x3) * (y3 - y4) - (y1 - y3) * (x3 - x4)) / den;
-		auto u = -((x1 - x2) * (y1 - y3) - (y1 - y2) * (x1 - x3)) / den;
-
-		if (t > 0 && t < 1 && u > 0)
-		{
-			return std::make_shared<RayIntersection>(
-				true,
-				sf::Vector2f(
-					x1 + t * (x2 - x1),
-					y1 + t * (y2 - y1))
-            );
-		}
+		auto& intersection = intersections[i];
+		intersection.intersects = hit;
+		intersection.distance = hit ? distance : 0.0f;
+		intersection.point = hit ? origin + direction * distance : sf::Vector2f();
 	}
-
-	return std::make_shared<RayIntersection>(false);
-}
\ No newline at end of file
+}
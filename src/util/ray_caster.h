@@ -10,11 +10,18 @@ public:
 	RayCaster() = default;
 	~RayCaster() override = default;
 
-	[[nodiscard]] std::shared_ptr<RayIntersection> RayBoxIntersects(
+	[[nodiscard]] RayIntersection RayBoxIntersects(
         const sf::Vector2f& origin,
         const sf::Vector2f& direction,
         sf::FloatRect box
     ) const override;
+
+	void RayBoxIntersects(
+        const sf::Vector2f& origin,
+        const sf::Vector2f& direction,
+        const RayBoxBatch& boxes,
+        std::vector<RayIntersection>& intersections
+    ) const override;
 };
 
-#endif
\ No newline at end of file
+#endif
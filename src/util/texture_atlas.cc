@@ -16,11 +16,29 @@ std::shared_ptr<ITextureAtlas> TextureAtlas::AddTexture(const std::string& tag,
 	auto texture = std::make_shared<sf::Texture>();
 	texture->loadFromImage(image);
 
-	this->textures[tag] = texture;
+	// Re-adding a tag swaps the texture but keeps its handle
+	auto [it, inserted] = this->handles.try_emplace(tag, static_cast<TextureHandle>(this->textures.size()));
+	if (inserted) {
+		this->textures.push_back(texture);
+	} else {
+		this->textures[static_cast<size_t>(it->second)] = texture;
+	}
 	return shared_from_this();
 }
 
 std::shared_ptr<sf::Texture> TextureAtlas::GetTexture(const std::string& tag) const
 {
-	return this->textures.at(tag);
+	return this->textures[static_cast<size_t>(this->handles.at(tag))];
+}
+
+TextureHandle TextureAtlas::FindTexture(const std::string& tag) const
+{
+	auto it = this->handles.find(tag);
+	return it != this->handles.end() ? it->second : TextureHandle::INVALID;
+}
+
+sf::Texture* TextureAtlas::Resolve(TextureHandle handle) const
+{
+	auto index = static_cast<size_t>(handle);
+	return index < this->textures.size() ? this->textures[index].get() : nullptr;
 }
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include <SFML/Graphics.hpp>
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include "i_texture_atlas.h"
 
@@ -15,9 +16,12 @@ public:
 
 	virtual std::shared_ptr<ITextureAtlas> AddTexture(const std::string& tag, const std::string& texturePath) override;
 	virtual std::shared_ptr<sf::Texture> GetTexture(const std::string& tag) const override;
+	virtual TextureHandle FindTexture(const std::string& tag) const override;
+	virtual sf::Texture* Resolve(TextureHandle handle) const override;
 
 private:
-	std::unordered_map<std::string, std::shared_ptr<sf::Texture>> textures;
+	std::vector<std::shared_ptr<sf::Texture>> textures;
+	std::unordered_map<std::string, TextureHandle> handles;
 };
 
 #endif
\ No newline at end of file